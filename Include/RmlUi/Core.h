@@ -62,6 +62,7 @@
 #include "Core/FontEffectInstancer.h"
 #include "Core/FontEngineInterface.h"
 #include "Core/FontGlyph.h"
+#include "Core/FrameStatistics.h"
 #include "Core/Geometry.h"
 #include "Core/GeometryUtilities.h"
 #include "Core/ID.h"
@@ -82,6 +83,7 @@
 #include "Core/StyleSheetSpecification.h"
 #include "Core/SystemInterface.h"
 #include "Core/Texture.h"
+#include "Core/TextureStatistics.h"
 #include "Core/Transform.h"
 #include "Core/TransformPrimitive.h"
 #include "Core/Tween.h"
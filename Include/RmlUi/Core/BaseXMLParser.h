@@ -65,8 +65,10 @@ class RMLUICORE_API BaseXMLParser
 		void RegisterInnerXMLAttribute(const String& attribute_name);
 
 		/// Parses the given stream as an XML file, and calls the handlers when
-		/// interesting phenomena are encountered.
-		void Parse(Stream* stream);
+		/// interesting phenomena are encountered. Compiled documents, see Rml::CompileDocument(), are
+		/// recognized and call the same handlers as their source document.
+		/// @return False if the stream is a compiled document which is invalid or of an unsupported version, in which case no handlers are called.
+		bool Parse(Stream* stream);
 
 		/// Get the line number in the stream.
 		/// @return The line currently being processed in the XML stream.
@@ -99,6 +101,7 @@ class RMLUICORE_API BaseXMLParser
 
 		void ReadHeader();
 		void ReadBody();
+		bool ReadCompiledBody();
 		bool ReadOpenTag();
 
 		bool ReadCloseTag(size_t xml_index_tag);
@@ -33,6 +33,7 @@
 #include "Types.h"
 #include "Traits.h"
 #include "Input.h"
+#include "FrameStatistics.h"
 #include "ScriptInterface.h"
 
 namespace Rml {
@@ -45,6 +46,16 @@ class RenderInterface;
 class DataModel;
 class DataModelConstructor;
 class DataTypeRegister;
+class AnimationTimeline;
+class Geometry;
+class GeometryArena;
+class ElementUtilities;
+class WorkerPool;
+class DecoratorGeometryCache;
+class ElementBackgroundBorder;
+class ElementRenderCache;
+class EventDispatchBuffersScope;
+struct EventDispatchBuffers;
 enum class EventId : uint16_t;
 
 /**
@@ -87,6 +98,20 @@ public:
 	/// Renders all visible elements in the context's documents.
 	bool Render();
 
+	/// Enables or disables the geometry arena of this context. When enabled, the vertices and indices of geometry in this
+	/// context are moved into large buffers shared by all the geometry once rendered, instead of one allocation per geometry.
+	/// @param[in] enable True to enable the arena, false to disable it and move all geometry back into its own buffers.
+	void EnableGeometryArena(bool enable);
+
+	/// Sets the number of worker threads used to prepare geometry before rendering. When enabled, each call to Render()
+	/// first regenerates the dirty background and border geometry of all displayed elements in parallel, before the
+	/// elements are drawn. Decorators and text are still generated while drawing, as they share caches between threads.
+	/// @param[in] num_workers The number of worker threads in addition to the rendering thread, or zero to disable the prepare phase.
+	void SetNumGeometryWorkers(int num_workers);
+
+	/// Returns the statistics of the most recent frame. They are reset at the start of every update, and include the following render.
+	const FrameStatistics& GetFrameStatistics() const;
+
 	/// Creates a new, empty document and places it into this context.
 	/// @param[in] instancer_name The name of the instancer used to create the document.
 	/// @return The new document, or nullptr if no document could be created.
@@ -317,6 +342,12 @@ private:
 	// itself can't be part of it.
 	ElementSet drag_hover_chain;
 
+	// Containers reused on every mouse move, so that their memory does not need to be reallocated.
+	ElementSet unused_hover_chain;
+	ElementSet unused_drag_hover_chain;
+	Dictionary mouse_move_parameters;
+	Dictionary drag_move_parameters;
+
 	// Input state; stored from the most recent input events we receive from the application.
 	Vector2i mouse_position;
 
@@ -325,11 +356,47 @@ private:
 	Vector2i clip_origin;
 	Vector2i clip_dimensions;
 
+	// Identifies the current call to Render(), or zero when not rendering. Elements cache their clipping region for its duration.
+	unsigned int render_pass = 0;
+	unsigned int render_pass_counter = 0;
+
+	// The texture database frame in which this context was last rendered. Rendering it again begins a new frame.
+	unsigned int texture_frame = 0;
+
 	using DataModels = UnorderedMap<String, UniquePtr<DataModel>>;
 	DataModels data_models;
 
 	UniquePtr<DataTypeRegister> data_type_register;
 
+	// Advances the animations of all elements in the context.
+	UniquePtr<AnimationTimeline> animation_timeline;
+
+	FrameStatistics frame_statistics;
+
+	// Optional shared storage of the vertices and indices of geometry in the context.
+	UniquePtr<GeometryArena> geometry_arena;
+
+	// Optional worker threads for regenerating geometry before rendering.
+	UniquePtr<WorkerPool> geometry_workers;
+	// Elements whose background or border geometry was dirtied since the last render, only collected when the workers are enabled.
+	Vector<ObserverPtr<Element>> dirty_background_border_elements;
+
+	// Geometry shared between the decorators of elements in this context, created on first use.
+	SharedPtr<DecoratorGeometryCache> decorator_geometry_cache;
+
+	// The number of element render caches which have been rendered in this context, shared with the caches so that they
+	// may outlive the context. Used to avoid searching for caches to dirty when there are none.
+	SharedPtr<int> num_render_caches;
+
+	// Scratch buffers reused between event dispatches in this context, one set for each level of nested dispatches.
+	Vector<UniquePtr<EventDispatchBuffers>> event_dispatch_buffers;
+	int event_dispatch_depth = 0;
+
+	// Regenerates the dirty background and border geometry of all displayed elements on the geometry workers.
+	void PrepareGeometry();
+	// Queues the background and border geometry of the element to be regenerated on the geometry workers, if enabled.
+	void DirtyBackgroundBorder(Element* element);
+
 	// Internal callback for when an element is detached or removed from the hierarchy.
 	void OnElementDetach(Element* element);
 	// Internal callback for when a new element gains focus.
@@ -365,6 +432,12 @@ private:
 	static void SendEvents(const ElementSet& old_items, const ElementSet& new_items, EventId id, const Dictionary& parameters);
 
 	friend class Rml::Element;
+	friend class Rml::ElementUtilities;
+	friend class Rml::Geometry;
+	friend class Rml::DecoratorGeometryCache;
+	friend class Rml::ElementBackgroundBorder;
+	friend class Rml::ElementRenderCache;
+	friend class Rml::EventDispatchBuffersScope;
 	friend RMLUICORE_API Context* CreateContext(const String&, Vector2i, RenderInterface*);
 };
 
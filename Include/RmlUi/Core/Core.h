@@ -33,6 +33,8 @@
 #include "Types.h"
 #include "Event.h"
 #include "ComputedValues.h"
+#include "Texture.h"
+#include "TextureStatistics.h"
 
 namespace Rml {
 
@@ -146,6 +148,36 @@ RMLUICORE_API EventId RegisterEventType(const String& type, bool interruptible,
 RMLUICORE_API StringList GetTextureSourceList();
 /// Forces all texture handles loaded and generated by RmlUi to be released.
 RMLUICORE_API void ReleaseTextures();
+/// Enables packing of small textures loaded from file into shared atlas textures, so that geometry using different images
+/// can be rendered with the same texture. Requires RenderInterface::LoadTextureData() to be implemented, and applies to
+/// textures loaded after this call. Textures used during layout are packed together when the first of them is rendered.
+/// Must be called after Rml::Initialise.
+/// @param[in] max_image_size The largest width or height of a texture to be packed, or zero to disable the atlas.
+/// @param[in] page_size The largest width or height of each atlas texture.
+RMLUICORE_API void SetTextureAtlas(int max_image_size, int page_size = 1024);
+/// Enables loading image files on a background thread. The file interface and the decoder are called from the loader
+/// thread, while the decoded textures are uploaded through the render interface when a context is rendered. Images
+/// are transparent until their texture has been uploaded. Must be called after Rml::Initialise.
+/// @param[in] decoder Decodes the file contents to RGBA pixels, or an empty function to disable asynchronous loading.
+/// @param[in] max_uploads_per_frame The largest number of textures uploaded each time a context is rendered.
+/// @param[in] loaded_callback Optional function called after each texture has been uploaded, or failed to load.
+RMLUICORE_API void SetAsyncTextureLoading(const TextureDecoder& decoder, int max_uploads_per_frame = 8, const TextureLoadedCallback& loaded_callback = nullptr);
+/// Sets a budget for the memory of textures loaded through the render interface. Once per frame, detected when a context
+/// is rendered again, the least recently used textures are evicted while over budget: textures from file no longer used
+/// by any element, and generated textures such as font textures not rendered by any context in the previous frame, which
+/// are generated again when needed.
+/// Referenced textures from file are never evicted, so the budget may still be exceeded. Must be called after Rml::Initialise.
+/// @param[in] memory_budget The budget in bytes, estimated at four bytes per pixel, or zero for no budget.
+RMLUICORE_API void SetTextureMemoryBudget(size_t memory_budget);
+/// Returns the memory used by textures, the budget, and the number of textures evicted.
+RMLUICORE_API TextureStatistics GetTextureStatistics();
+/// Compiles an RML document into a binary form that is instanced without parsing its markup, for documents that do
+/// not change between runs. Compiled documents are loaded like their source, such as through Context::LoadDocument(),
+/// and keep referring to their style sheets and templates by path. Must be called after Rml::Initialise.
+/// @param[in] document_path The path of the RML document, opened through the file interface.
+/// @param[out] compiled_document The compiled document, to be saved by the application.
+/// @return True if the document was opened, false otherwise.
+RMLUICORE_API bool CompileDocument(const String& document_path, String& compiled_document);
 /// Forces all compiled geometry handles generated by RmlUi to be released.
 RMLUICORE_API void ReleaseCompiledGeometry();
 
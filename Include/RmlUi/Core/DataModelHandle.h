@@ -47,6 +47,14 @@ public:
 	bool IsVariableDirty(const String& variable_name);
 	void DirtyVariable(const String& variable_name);
 
+	// Queue a new value for a data variable, which may be posted from any thread.
+	// All posted values are applied in the order they were posted at the start of the next 'Context::Update()', and
+	// the corresponding variables are dirtied.
+	// @param[in] variable_address The address of the variable, eg. "player.health" or "items[3].name". Aliases are not supported.
+	// @param[in] value The new value of the variable.
+	// @note The data model must outlive any calls to this function.
+	void PostVariableUpdate(const String& variable_address, const Variant& value);
+
 	explicit operator bool() { return model; }
 
 private:
@@ -117,6 +125,13 @@ public:
 		type_register->GetTransformFuncRegister()->Register(name, std::move(transform_func));
 	}
 
+	// Enable or disable automatic change detection of scalar variables.
+	// When enabled, the model keeps a snapshot of the value of every bound scalar and get/set function variable, and
+	// compares them on each update. Only variables whose value actually changed are dirtied, so calling
+	// 'DataModelHandle::DirtyVariable' is not required for such variables. Array and struct variables must still be dirtied manually.
+	// @note Every get function is called once per update while enabled.
+	void SetChangeDetection(bool enable);
+
 	explicit operator bool() { return model && type_register; }
 
 private:
@@ -37,6 +37,7 @@ namespace Rml {
 
 class DecoratorInstancer;
 class Element;
+class ElementDecoration;
 class PropertyDictionary;
 class Property;
 struct Texture;
@@ -91,6 +92,8 @@ private:
 	// Optimized for the common case of a single texture.
 	Texture first_texture;
 	Vector< Texture > additional_textures;
+
+	friend class Rml::ElementDecoration;
 };
 
 } // namespace Rml
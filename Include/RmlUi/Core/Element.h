@@ -42,17 +42,24 @@
 
 namespace Rml {
 
+class AnimationTimeline;
 class Context;
 class DataModel;
 class Decorator;
 class ElementInstancer;
+class ElementInstancerElement;
+class ElementInstancerText;
 class EventDispatcher;
 class EventListener;
+class ElementBackgroundBorder;
 class ElementDecoration;
 class ElementDefinition;
 class ElementDocument;
+class ElementRenderCache;
 class ElementScroll;
 class ElementStyle;
+class ElementUtilities;
+class HitTestGrid;
 class LayoutEngine;
 class LayoutInlineBox;
 class LayoutBlockBox;
@@ -626,6 +633,9 @@ protected:
 	/// Called when a child node has been removed up to two levels below us in the hierarchy.
 	/// @param[in] child The element that has been removed. This may be this element.
 	virtual void OnChildRemove(Element* child);
+	/// Called when textures used by this element while they were loading asynchronously have been uploaded, so that
+	/// any geometry generated while they were loading can be regenerated.
+	virtual void OnTexturesLoaded();
 
 	/// Forces a re-layout of this element, and any other elements required.
 	virtual void DirtyLayout();
@@ -662,11 +672,40 @@ private:
 	void DirtyStackingContext();
 
 	void DirtyStructure();
+
+	// Marks this element and its ancestors as needing to be visited during the next update.
+	void DirtyUpdate();
 	void UpdateStructure();
 
 	void DirtyTransformState(bool perspective_dirty, bool transform_dirty);
 	void UpdateTransformState();
 
+	// Returns true if we can skip rendering ourself, as none of our boxes intersect our clipping region or the context's viewport.
+	bool IsRenderCulled();
+	// Returns true if our stacking context cannot be visible whenever we are culled, as it is clipped to our client area.
+	bool IsStackingContextCulledWithUs();
+	// Returns true if any element in our stacking context, or in nested stacking contexts, may escape our clipping.
+	bool CanStackingContextEscapeClipping();
+
+	// Invalidates our entry in the hit test grid of our stacking context, must be called whenever our hit area may have changed.
+	void DirtyHitTest();
+	// Invalidates the render caches of this element and its ancestors, must be called whenever the element's rendering may have changed.
+	void DirtyRenderCache();
+
+	// Returns the background and border geometry of this element.
+	ElementBackgroundBorder& GetBackgroundBorder();
+	// Notifies this element that textures it was waiting for have been loaded, and invalidates any render caches containing it.
+	void NotifyTexturesLoaded();
+
+	// Sets a property value resulting from an animation, bypassing the style computation where possible.
+	void SetAnimationProperty(PropertyId id, const Property& property);
+	// Passes an animated opacity down to any descendants inheriting it.
+	void InheritAnimationOpacity(const PropertyIdSet& changed_properties);
+	// Removes completed animations and submits their end events.
+	void HandleCompletedAnimations();
+	// Must be called whenever animations are added to or removed from the animation list.
+	void DirtyAnimationTracks();
+
 	/// Start an animation, replacing any existing animations of the same property name. If start_value is null, the element's current value is used.
 	ElementAnimationList::iterator StartAnimation(PropertyId property_id, const Property * start_value, int num_iterations, bool alternate_direction, float delay, bool initiated_by_animation_property);
 
@@ -750,9 +789,28 @@ private:
 
 	ElementList stacking_context;
 	bool stacking_context_dirty;
+	// Accelerates hit testing of large stacking contexts, only allocated when needed.
+	UniquePtr< HitTestGrid > hit_test_grid;
+	// Renders us and our stacking context into a texture to be reused between frames, enabled by the 'render-cache' attribute.
+	UniquePtr< ElementRenderCache > render_cache;
+	// The clipping region applied to our descendants, cached for the duration of a single render pass of our context.
+	struct DescendantClipCache {
+		unsigned int render_pass = 0;
+		bool clip = false;
+		Vector2i origin;
+		Vector2i dimensions;
+	};
+	DescendantClipCache descendant_clip_cache;
 
 	bool structure_dirty;
 
+	// True if this element or any of its descendants need to be updated, otherwise the subtree is skipped during update.
+	bool update_dirty;
+	// False for element types known not to override OnUpdate(), which then don't need to be updated every frame.
+	bool update_every_frame;
+	// True for element types known to render only within their border boxes, which can then be culled during rendering.
+	bool render_within_border_box;
+
 	bool computed_values_are_default_initialized;
 
 	// Transform state
@@ -763,15 +821,23 @@ private:
 	ElementAnimationList animations;
 	bool dirty_animation;
 	bool dirty_transition;
+	// True if the animations are advanced by the context's animation timeline.
+	bool in_animation_timeline;
 
 	ElementMeta* meta;
 
+	friend class Rml::AnimationTimeline;
 	friend class Rml::Context;
+	friend class Rml::ElementRenderCache;
 	friend class Rml::ElementStyle;
+	friend class Rml::ElementUtilities;
 	friend class Rml::LayoutEngine;
 	friend class Rml::LayoutBlockBox;
 	friend class Rml::LayoutInlineBox;
 	friend class Rml::ElementScroll;
+	friend class Rml::HitTestGrid;
+	friend class Rml::ElementInstancerElement;
+	friend class Rml::ElementInstancerText;
 };
 
 } // namespace Rml
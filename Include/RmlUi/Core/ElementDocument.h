@@ -37,6 +37,7 @@ class Context;
 class Stream;
 class DocumentHeader;
 class ElementText;
+class ElementIndex;
 class StyleSheet;
 
 /**
@@ -188,8 +189,12 @@ private:
 
 	bool position_dirty;
 
+	// Indexes the elements owned by the document by id, tag and class.
+	UniquePtr<ElementIndex> element_index;
+
 	friend class Rml::Context;
 	friend class Rml::Factory;
+	friend class Rml::ElementIndex;
 
 };
 
@@ -57,6 +57,8 @@ public:
 
 	/// Updates the increment / decrement arrows.
 	void Update();
+	/// Returns true if any scrollbars have been created, these must be updated every frame.
+	bool HasScrollbars() const;
 
 	/// Enables and sizes one of the scrollbars.
 	/// @param[in] orientation Which scrollbar (vertical or horizontal) to enable.
@@ -142,6 +142,11 @@ public:
 	/// Right now, this only applies to the 'data-for' view.
 	/// @return True if a data view was constructed.
 	static bool ApplyStructuralDataViews(Element* element, const String& inner_rml);
+
+private:
+	// Finds the clipping region applied to the descendants of an element which don't ignore any clipping regions themselves.
+	// The region is cached on the element during rendering, so that each element only needs to look at its parent's region.
+	static bool GetDescendantClippingRegion(Vector2i& clip_origin, Vector2i& clip_dimensions, Element* element, unsigned int render_pass);
 };
 
 } // namespace Rml
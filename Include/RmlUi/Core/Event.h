@@ -39,6 +39,7 @@ namespace Rml {
 class Factory;
 class Element;
 class EventInstancer;
+class EventInstancerDefault;
 struct EventSpecification;
 
 enum class EventPhase { None, Capture = 1, Target = 2, Bubble = 4 };
@@ -131,6 +132,9 @@ private:
 	/// Release this event through its instancer.
 	void Release() override;
 
+	/// Reinitialise the event with new values, allowing the event to be reused instead of reallocated.
+	void Reset(Element* target, EventId id, const String& type, const Dictionary& parameters, bool interruptible);
+
 	String type;
 	EventId id = EventId::Invalid;
 	bool interruptible = false;
@@ -146,6 +150,7 @@ private:
 	EventInstancer* instancer = nullptr;
 
 	friend class Rml::Factory;
+	friend class Rml::EventInstancerDefault;
 };
 
 
@@ -0,0 +1,74 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_FRAMESTATISTICS_H
+#define RMLUI_CORE_FRAMESTATISTICS_H
+
+#include "Header.h"
+#include "Types.h"
+
+namespace Rml {
+
+/**
+	Statistics of a context over a single frame, that is a call to Context::Update() and the following Context::Render().
+
+	The statistics are always collected, independent of the profiling build options, and are cheap enough for use in
+	production telemetry. Retrieve them from Context::GetFrameStatistics().
+ */
+
+struct RMLUICORE_API FrameStatistics
+{
+	/// Number of elements visited during the update, elements in unchanged subtrees are skipped.
+	int num_elements_updated = 0;
+	/// Number of element definitions looked up in the style sheet.
+	int num_definitions_resolved = 0;
+	/// Number of properties computed, summed over all elements.
+	int num_properties_computed = 0;
+
+	/// Number of document layouts, and the source URLs of the documents laid out.
+	int num_layouts = 0;
+	StringList layout_documents;
+
+	/// Number of background, border, decorator and text geometries generated.
+	int num_geometry_generated = 0;
+
+	/// Number of geometries submitted to the render interface, and their total number of vertices.
+	int num_draw_calls = 0;
+	int num_vertices = 0;
+
+	/// Number of textures loaded or generated through the render interface.
+	int num_textures_generated = 0;
+
+	/// Time spent in the update, in the layout of documents as part of the update, and in rendering, in seconds.
+	double update_time = 0;
+	double layout_time = 0;
+	double render_time = 0;
+};
+
+} // namespace Rml
+#endif
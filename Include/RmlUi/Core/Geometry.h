@@ -37,8 +37,10 @@ namespace Rml {
 
 class Context;
 class Element;
+class GeometryArena;
 class RenderInterface;
 struct Texture;
+struct GeometryOpacityCopy;
 using GeometryDatabaseHandle = uint32_t;
 
 /**
@@ -96,6 +98,22 @@ private:
 	// Returns the host context's render interface.
 	RenderInterface* GetRenderInterface();
 
+	// Renders a copy of the geometry with the opacity applied to its vertex colours, for renderers not applying opacity themselves.
+	void RenderWithOpacity(RenderInterface* render_interface, Vector2f translation, float opacity, Vertex* vertex_data, int num_vertices, int* index_data, int num_indices);
+	// Releases the opacity copy of the geometry.
+	void ReleaseOpacityCopy();
+
+	// Remaps the texture coordinates of the vertices in place to the atlas page region our texture is packed into, or
+	// restores them if it is no longer packed. Any compiled geometry is released when the coordinates change.
+	void ApplyTextureAtlas(RenderInterface* render_interface, Vertex* vertex_data, int num_vertices);
+	// Restores the texture coordinates of the vertices from the atlas page region they are remapped to, if any.
+	void RestoreTextureAtlas(Vertex* vertex_data, int num_vertices);
+
+	// Moves our vertices and indices into the geometry arena of the host context, if it has one.
+	void CommitToArena();
+	// Moves our vertices and indices back from the geometry arena into our own buffers, so that they can be modified.
+	void ExtractFromArena();
+
 	Context* host_context = nullptr;
 	Element* host_element = nullptr;
 
@@ -105,8 +123,23 @@ private:
 
 	CompiledGeometryHandle compiled_geometry = 0;
 	bool compile_attempted = false;
+	// The handle of our texture when the geometry was compiled.
+	TextureHandle compiled_texture_handle = 0;
+
+	UniquePtr<GeometryOpacityCopy> opacity_copy;
+
+	// The atlas page region our texture coordinates are currently remapped to, if applied.
+	bool atlas_applied = false;
+	Vector2f atlas_texcoord_offset;
+	Vector2f atlas_texcoord_scale;
+
+	// When committed to an arena, our vertices and indices are stored there instead of in our own buffers.
+	GeometryArena* arena = nullptr;
+	int arena_handle = -1;
 
 	GeometryDatabaseHandle database_handle;
+
+	friend class Rml::GeometryArena;
 };
 
 using GeometryList = Vector< Geometry >;
@@ -38,6 +38,9 @@
 namespace Rml {
 
 class Context;
+class Element;
+class ElementRenderCache;
+class Geometry;
 
 /**
 	The abstract base class for application-specific rendering implementation. Your application must provide a concrete
@@ -96,6 +99,13 @@ public:
 	/// @param[in] source The application-defined image source, joined with the path of the referencing document.
 	/// @return True if the load attempt succeeded and the handle and dimensions are valid, false if not.
 	virtual bool LoadTexture(TextureHandle& texture_handle, Vector2i& texture_dimensions, const String& source);
+	/// Called by RmlUi when it wants the pixels of a texture, to pack small images into shared atlas textures. This is
+	/// only called when the texture atlas is enabled, see Rml::SetTextureAtlas().
+	/// @param[out] data The raw 8-bit texture data. Each pixel is made up of four 8-bit values, indicating red, green, blue and alpha in that order.
+	/// @param[out] dimensions The dimensions, in pixels, of the loaded data.
+	/// @param[in] source The application-defined image source, joined with the path of the referencing document.
+	/// @return True if the data was loaded, false (the default) to load the texture through LoadTexture() instead.
+	virtual bool LoadTextureData(UniquePtr<const byte[]>& data, Vector2i& dimensions, const String& source);
 	/// Called by RmlUi when a texture is required to be built from an internally-generated sequence of pixels.
 	/// @param[out] texture_handle The handle to write the texture handle for the generated texture to.
 	/// @param[in] source The raw 8-bit texture data. Each pixel is made up of four 8-bit values, indicating red, green, blue and alpha in that order.
@@ -112,14 +122,45 @@ public:
 	/// @param[in] transform The new transform to apply, or nullptr if no transform applies to the current element.
 	virtual void SetTransform(const Matrix4f* transform);
 
+	/// Called by RmlUi when it wants the renderer to apply a new opacity to subsequently rendered geometry. The alpha
+	/// channel of each vertex colour should be multiplied by the opacity. This is only called when the opacity changes
+	/// between rendered elements, and is reset to 1 after each context has been rendered.
+	/// @param[in] opacity The new opacity to apply, in the range [0, 1].
+	/// @return True if the renderer applies the opacity, false to let RmlUi apply it by rewriting the vertex colours of a cached copy of each geometry.
+	virtual bool SetOpacity(float opacity);
+
+	/// Called by RmlUi when it wants subsequent geometry to be rendered into a new off-screen texture instead of the
+	/// current render target. This is only called for elements with the 'render-cache' attribute. Geometry is still
+	/// submitted in context coordinates, only the given region should be captured. Calls may be nested. Render caching
+	/// is off by default: unless this is overridden, such elements are rendered normally every frame. The renderers of
+	/// the sample shell do not implement it.
+	/// @param[in] origin The top-left corner of the region to capture, in pixels of the context.
+	/// @param[in] dimensions The dimensions of the region, and of the resulting texture.
+	/// @return True if render-to-texture is supported and has begun, false (the default) to render the element normally.
+	virtual bool BeginRenderToTexture(const Vector2i& origin, const Vector2i& dimensions);
+	/// Called by RmlUi when it has finished rendering into the texture started by the matching BeginRenderToTexture().
+	/// The texture is drawn at the captured region, and should appear as if its geometry was rendered there directly.
+	/// @return The handle of the texture, released with ReleaseTexture() when no longer needed, or zero on failure.
+	virtual TextureHandle EndRenderToTexture();
+
 	/// Get the context currently being rendered. This is only valid during RenderGeometry,
 	/// CompileGeometry, RenderCompiledGeometry, EnableScissorRegion and SetScissorRegion.
 	Context* GetContext() const;
 
 private:
+	// Submits the opacity to the renderer if it differs from the current one.
+	void ApplyOpacity(float opacity);
+
 	Context* context;
 
+	// The opacity currently applied, and whether the renderer applies it or geometry must apply it to its vertex colours.
+	float opacity = 1.f;
+	bool opacity_applied_by_renderer = true;
+
 	friend class Rml::Context;
+	friend class Rml::Element;
+	friend class Rml::ElementRenderCache;
+	friend class Rml::Geometry;
 };
 
 } // namespace Rml
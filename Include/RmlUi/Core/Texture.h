@@ -34,6 +34,8 @@
 
 namespace Rml {
 
+class Geometry;
+class TextureDatabase;
 class TextureResource;
 class RenderInterface;
 
@@ -46,6 +48,24 @@ class RenderInterface;
 */
 using TextureCallback = Function<bool(const String& name, UniquePtr<const byte[]>& data, Vector2i& dimensions)>;
 
+/*
+	Decoder function for textures loaded asynchronously. It is called on the texture loader thread.
+	/// @param[in] source The source of the texture, joined with the path of the referencing document.
+	/// @param[in] file_data The contents of the file, read through the file interface.
+	/// @param[in] file_size The size of the file contents in bytes.
+	/// @param[out] data The raw data of the texture, each pixel has four 8-bit channels: red-green-blue-alpha.
+	/// @param[out] dimensions The width and height of the decoded texture.
+	/// @return True on success.
+*/
+using TextureDecoder = Function<bool(const String& source, const byte* file_data, size_t file_size, UniquePtr<const byte[]>& data, Vector2i& dimensions)>;
+
+/*
+	Callback function for when a texture loaded asynchronously has been uploaded, or has failed to load.
+	/// @param[in] source The source of the texture.
+	/// @param[in] success True if the texture was loaded.
+*/
+using TextureLoadedCallback = Function<void(const String& source, bool success)>;
+
 
 /**
 	Abstraction of a two-dimensional texture image, with an application-specific texture handle.
@@ -86,6 +106,9 @@ public:
 
 private:
 	SharedPtr<TextureResource> resource;
+
+	friend class Rml::Geometry;
+	friend class Rml::TextureDatabase;
 };
 
 } // namespace Rml
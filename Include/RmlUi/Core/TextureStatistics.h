@@ -0,0 +1,58 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_TEXTURESTATISTICS_H
+#define RMLUI_CORE_TEXTURESTATISTICS_H
+
+#include "Header.h"
+#include "Types.h"
+
+namespace Rml {
+
+/**
+	Statistics of the textures loaded through the render interface, shared by all contexts.
+
+	Texture memory is estimated at four bytes per pixel, counting texture atlas pages once. Retrieve the statistics from
+	Rml::GetTextureStatistics(), and set the budget with Rml::SetTextureMemoryBudget().
+ */
+
+struct RMLUICORE_API TextureStatistics
+{
+	/// The texture memory budget in bytes, or zero if unlimited.
+	size_t memory_budget = 0;
+	/// Estimated memory of all loaded textures, in bytes.
+	size_t memory_used = 0;
+
+	/// Number of loaded textures, including font textures and texture atlas pages.
+	int num_textures = 0;
+	/// Number of textures evicted to stay within the budget since the library was initialised.
+	int num_evicted = 0;
+};
+
+} // namespace Rml
+#endif
@@ -60,6 +60,8 @@ public:
 
 	/// Called by RmlUi when a texture is required by the library.
 	bool LoadTexture(Rml::TextureHandle& texture_handle, Rml::Vector2i& texture_dimensions, const Rml::String& source) override;
+	/// Called by RmlUi when it wants the pixels of a texture, to pack it into an atlas.
+	bool LoadTextureData(Rml::UniquePtr<const Rml::byte[]>& data, Rml::Vector2i& dimensions, const Rml::String& source) override;
 	/// Called by RmlUi when a texture is required to be built from an internally-generated sequence of pixels.
 	bool GenerateTexture(Rml::TextureHandle& texture_handle, const Rml::byte* source, const Rml::Vector2i& source_dimensions) override;
 	/// Called by RmlUi when a loaded texture is no longer required.
@@ -68,6 +70,8 @@ public:
 	/// Called by RmlUi when it wants to set the current transform matrix to a new matrix.
 	void SetTransform(const Rml::Matrix4f* transform) override;
 
+	// The render-to-texture hooks are not implemented, elements with the 'render-cache' attribute are rendered normally.
+
 	// Extensions used by the test suite
 	struct Image {
 		int width = 0;
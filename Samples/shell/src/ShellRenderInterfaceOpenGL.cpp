@@ -174,8 +174,8 @@ struct TGAHeader
 // Restore packing
 #pragma pack()
 
-// Called by RmlUi when a texture is required by the library.		
-bool ShellRenderInterfaceOpenGL::LoadTexture(Rml::TextureHandle& texture_handle, Rml::Vector2i& texture_dimensions, const Rml::String& source)
+// Called by RmlUi when it wants the pixels of a texture, to pack it into an atlas.
+bool ShellRenderInterfaceOpenGL::LoadTextureData(Rml::UniquePtr<const Rml::byte[]>& data, Rml::Vector2i& dimensions, const Rml::String& source)
 {
 	Rml::FileInterface* file_interface = Rml::GetFileInterface();
 	Rml::FileHandle file_handle = file_interface->Open(source);
@@ -241,15 +241,23 @@ bool ShellRenderInterfaceOpenGL::LoadTexture(Rml::TextureHandle& texture_handle,
 		}
 	}
 
-	texture_dimensions.x = header.width;
-	texture_dimensions.y = header.height;
-	
-	bool success = GenerateTexture(texture_handle, image_dest, texture_dimensions);
-	
-	delete [] image_dest;
+	dimensions.x = header.width;
+	dimensions.y = header.height;
+
+	data.reset(image_dest);
 	delete [] buffer;
-	
-	return success;
+
+	return true;
+}
+
+// Called by RmlUi when a texture is required by the library.
+bool ShellRenderInterfaceOpenGL::LoadTexture(Rml::TextureHandle& texture_handle, Rml::Vector2i& texture_dimensions, const Rml::String& source)
+{
+	Rml::UniquePtr<const Rml::byte[]> data;
+	if (!LoadTextureData(data, texture_dimensions, source))
+		return false;
+
+	return GenerateTexture(texture_handle, data.get(), texture_dimensions);
 }
 
 // Called by RmlUi when a texture is required to be built from an internally-generated sequence of pixels.
@@ -0,0 +1,189 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "AnimationTimeline.h"
+#include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+#include "ElementAnimation.h"
+#include <algorithm>
+
+namespace Rml {
+
+AnimationTimeline::AnimationTimeline()
+{}
+
+AnimationTimeline::~AnimationTimeline()
+{
+	for (ObserverPtr<Element>& element : elements)
+	{
+		if (element)
+			element->in_animation_timeline = false;
+	}
+}
+
+void AnimationTimeline::AddElement(Element* element)
+{
+	RMLUI_ASSERT(element && !element->in_animation_timeline);
+
+	element->in_animation_timeline = true;
+	elements.push_back(element->GetObserverPtr());
+	tracks_dirty = true;
+}
+
+void AnimationTimeline::RemoveElement(Element* element)
+{
+	RMLUI_ASSERT(element && element->in_animation_timeline);
+
+	// The element is only cleared here and erased when the tracks are rebuilt, so that the tracks' element indices stay valid.
+	auto it = std::find_if(elements.begin(), elements.end(), [element](const ObserverPtr<Element>& ptr) { return ptr.get() == element; });
+	if (it != elements.end())
+		it->reset();
+
+	element->in_animation_timeline = false;
+	tracks_dirty = true;
+}
+
+void AnimationTimeline::DirtyTracks()
+{
+	tracks_dirty = true;
+}
+
+void AnimationTimeline::Update(double current_time)
+{
+	RMLUI_ZoneScoped;
+
+	// Elements may have been destroyed without being detached first, make sure we never touch their animations.
+	for (const ObserverPtr<Element>& element : elements)
+	{
+		if (!element)
+		{
+			tracks_dirty = true;
+			break;
+		}
+	}
+
+	if (tracks_dirty)
+		BuildTracks();
+
+	const size_t num_tracks = track_animation_indices.size();
+	if (num_tracks == 0)
+		return;
+
+	// Applying values may call into element code which starts animations, reallocating the element's animation list,
+	// or removes elements. Thus, the animations are looked up again by index every time they are accessed.
+	auto get_animation = [this](size_t i, Element*& element) -> ElementAnimation* {
+		element = elements[track_element_indices[i]].get();
+		if (!element || track_animation_indices[i] >= (int)element->animations.size())
+			return nullptr;
+		ElementAnimation* animation = &element->animations[track_animation_indices[i]];
+		if (animation->GetPropertyId() != track_property_ids[i])
+			return nullptr;
+		return animation;
+	};
+
+	// Interpolate all the tracks first, then apply the values. This keeps the interpolation loop free of any
+	// style changes, and the resulting properties are submitted in sequence for each element.
+	for (size_t i = 0; i < num_tracks; i++)
+	{
+		Element* element = nullptr;
+		ElementAnimation* animation = get_animation(i, element);
+		track_values[i] = (animation ? animation->UpdateAndGetProperty(current_time, *element) : Property());
+	}
+
+	for (size_t i = 0; i < num_tracks; i++)
+	{
+		if (track_values[i].unit == Property::UNKNOWN)
+			continue;
+
+		Element* element = nullptr;
+		if (ElementAnimation* animation = get_animation(i, element))
+			element->SetAnimationProperty(animation->GetPropertyId(), track_values[i]);
+	}
+
+	// Completed animations dispatch events, which may call any external code. Thus, the tracks must not be accessed after this point.
+	completed_elements.clear();
+	for (size_t i = 0; i < num_tracks; i++)
+	{
+		Element* element = nullptr;
+		ElementAnimation* animation = get_animation(i, element);
+		if (animation && animation->IsComplete() && (completed_elements.empty() || completed_elements.back().get() != element))
+			completed_elements.push_back(element->GetObserverPtr());
+	}
+
+	if (!completed_elements.empty())
+	{
+		tracks_dirty = true;
+
+		for (ObserverPtr<Element>& element : completed_elements)
+		{
+			if (element)
+				element->HandleCompletedAnimations();
+		}
+
+		completed_elements.clear();
+	}
+}
+
+void AnimationTimeline::BuildTracks()
+{
+	RMLUI_ZoneScoped;
+
+	tracks_dirty = false;
+
+	track_element_indices.clear();
+	track_animation_indices.clear();
+	track_property_ids.clear();
+
+	// Remove destroyed elements and elements which are no longer animating.
+	auto it_remove = std::partition(elements.begin(), elements.end(), [](const ObserverPtr<Element>& element) {
+		return element && !element->animations.empty();
+	});
+
+	for (auto it = it_remove; it != elements.end(); ++it)
+	{
+		if (Element* element = it->get())
+			element->in_animation_timeline = false;
+	}
+
+	elements.erase(it_remove, elements.end());
+
+	for (int element_index = 0; element_index < (int)elements.size(); element_index++)
+	{
+		const ElementAnimationList& animations = elements[element_index]->animations;
+		for (int animation_index = 0; animation_index < (int)animations.size(); animation_index++)
+		{
+			track_element_indices.push_back(element_index);
+			track_animation_indices.push_back(animation_index);
+			track_property_ids.push_back(animations[animation_index].GetPropertyId());
+		}
+	}
+
+	track_values.resize(track_animation_indices.size());
+}
+
+} // namespace Rml
@@ -0,0 +1,82 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_ANIMATIONTIMELINE_H
+#define RMLUI_CORE_ANIMATIONTIMELINE_H
+
+#include "../../Include/RmlUi/Core/Header.h"
+#include "../../Include/RmlUi/Core/Property.h"
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+class Element;
+class ElementAnimation;
+
+/**
+	Advances the animations of all elements in a context.
+
+	Elements are added when they start animating, and their animations are then gathered into a flat list of tracks,
+	which are advanced together once per update instead of during the recursive element update. The tracks are stored
+	as a structure of arrays, and rebuilt whenever animations are added or removed from any of the elements.
+ */
+
+class AnimationTimeline {
+public:
+	AnimationTimeline();
+	~AnimationTimeline();
+
+	/// Adds the animations of the given element to the timeline.
+	void AddElement(Element* element);
+	/// Removes the given element from the timeline.
+	void RemoveElement(Element* element);
+
+	/// Rebuild the tracks before the next update, must be called whenever the animations of an added element change.
+	void DirtyTracks();
+
+	/// Advances all animations to the given time and applies their values, then handles completed animations.
+	void Update(double current_time);
+
+private:
+	void BuildTracks();
+
+	Vector<ObserverPtr<Element>> elements;
+	bool tracks_dirty = false;
+
+	// One entry per animation in each array. Animations are referred to by the index of their element in the element
+	// list and their index in the element's animation list, together with their property id to detect any reordering.
+	Vector<int> track_element_indices;
+	Vector<int> track_animation_indices;
+	Vector<PropertyId> track_property_ids;
+	Vector<Property> track_values;
+
+	Vector<ObserverPtr<Element>> completed_elements;
+};
+
+} // namespace Rml
+#endif
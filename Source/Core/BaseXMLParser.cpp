@@ -29,6 +29,7 @@
 #include "../../Include/RmlUi/Core/BaseXMLParser.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/Stream.h"
+#include "CompiledDocument.h"
 #include "XMLParseTools.h"
 #include <string.h>
 
@@ -54,7 +55,7 @@ void BaseXMLParser::RegisterInnerXMLAttribute(const String& attribute_name)
 
 // Parses the given stream as an XML file, and calls the handlers when
 // interesting phenomenon are encountered.
-void BaseXMLParser::Parse(Stream* stream)
+bool BaseXMLParser::Parse(Stream* stream)
 {
 	source_url = &stream->GetSourceURL();
 
@@ -75,13 +76,25 @@ void BaseXMLParser::Parse(Stream* stream)
 	inner_xml_data_terminate_depth = 0;
 	inner_xml_data_index_begin = 0;
 
-	// Read (er ... skip) the header, if one exists.
-	ReadHeader();
-	// Read the XML body.
-	ReadBody();
+	bool result = true;
+
+	if (CompiledDocumentReader::IsCompiledDocument(xml_source))
+	{
+		// Replay the nodes of a compiled document.
+		result = ReadCompiledBody();
+	}
+	else
+	{
+		// Read (er ... skip) the header, if one exists.
+		ReadHeader();
+		// Read the XML body.
+		ReadBody();
+	}
 
 	xml_source.clear();
 	source_url = nullptr;
+
+	return result;
 }
 
 // Get the current file line number
@@ -216,6 +229,42 @@ void BaseXMLParser::ReadBody()
 	}
 }
 
+bool BaseXMLParser::ReadCompiledBody()
+{
+	RMLUI_ZoneScoped;
+
+	CompiledDocumentReader::Node node;
+
+	// Validate the whole document first, so that no handlers are called for a document which cannot be read.
+	{
+		CompiledDocumentReader validator(xml_source);
+		while (validator.ReadNode(node))
+		{}
+
+		if (validator.HasError())
+		{
+			Log::Message(Log::LT_ERROR, "Invalid or unsupported compiled document %s.", source_url->GetURL().c_str());
+			return false;
+		}
+	}
+
+	CompiledDocumentReader reader(xml_source);
+
+	while (reader.ReadNode(node))
+	{
+		line_number = node.line_number;
+
+		switch (node.type)
+		{
+		case CompiledDocumentReader::NodeType::ElementStart: HandleElementStartInternal(*node.name, node.attributes); break;
+		case CompiledDocumentReader::NodeType::ElementEnd:   HandleElementEndInternal(*node.name); break;
+		case CompiledDocumentReader::NodeType::Data:         HandleDataInternal(*node.data, node.data_type); break;
+		}
+	}
+
+	return true;
+}
+
 bool BaseXMLParser::ReadOpenTag()
 {
 	// Increase the open depth
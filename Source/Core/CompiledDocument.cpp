@@ -0,0 +1,280 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "CompiledDocument.h"
+#include "../../Include/RmlUi/Core/Factory.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+#include "../../Include/RmlUi/Core/Stream.h"
+#include <string.h>
+
+namespace Rml {
+
+static const char compiled_document_signature[4] = { 'R', 'M', 'L', 'C' };
+static constexpr uint32_t compiled_document_version = 1;
+
+CompiledDocumentWriter::CompiledDocumentWriter()
+{
+	// Tokenize the document the same way as the XML parser used to instance documents.
+	RegisterCDATATag("script");
+
+	for (const String& name : Factory::GetStructuralDataViewAttributeNames())
+		RegisterInnerXMLAttribute(name);
+}
+
+String CompiledDocumentWriter::Compile(Stream* stream)
+{
+	RMLUI_ZoneScoped;
+
+	string_indices.clear();
+	strings.clear();
+	nodes.clear();
+	num_nodes = 0;
+
+	Parse(stream);
+
+	String result(compiled_document_signature, sizeof(compiled_document_signature));
+	WriteInteger(result, compiled_document_version);
+
+	WriteInteger(result, (uint32_t)strings.size());
+	for (const String& string : strings)
+	{
+		WriteInteger(result, (uint32_t)string.size());
+		result += string;
+	}
+
+	WriteInteger(result, num_nodes);
+	result += nodes;
+
+	return result;
+}
+
+void CompiledDocumentWriter::HandleElementStart(const String& name, const XMLAttributes& attributes)
+{
+	num_nodes += 1;
+	nodes += (char)CompiledDocumentReader::NodeType::ElementStart;
+	WriteInteger(nodes, (uint32_t)GetLineNumber());
+	WriteInteger(nodes, AddString(name));
+
+	WriteInteger(nodes, (uint32_t)attributes.size());
+	for (const auto& attribute : attributes)
+	{
+		WriteInteger(nodes, AddString(attribute.first));
+		WriteInteger(nodes, AddString(attribute.second.Get<String>()));
+	}
+}
+
+void CompiledDocumentWriter::HandleElementEnd(const String& name)
+{
+	num_nodes += 1;
+	nodes += (char)CompiledDocumentReader::NodeType::ElementEnd;
+	WriteInteger(nodes, (uint32_t)GetLineNumber());
+	WriteInteger(nodes, AddString(name));
+}
+
+void CompiledDocumentWriter::HandleData(const String& data, XMLDataType type)
+{
+	num_nodes += 1;
+	nodes += (char)CompiledDocumentReader::NodeType::Data;
+	WriteInteger(nodes, (uint32_t)GetLineNumber());
+	nodes += (char)type;
+	WriteInteger(nodes, AddString(data));
+}
+
+uint32_t CompiledDocumentWriter::AddString(const String& string)
+{
+	auto it = string_indices.find(string);
+	if (it != string_indices.end())
+		return it->second;
+
+	const uint32_t index = (uint32_t)strings.size();
+	strings.push_back(string);
+	string_indices.emplace(string, index);
+	return index;
+}
+
+void CompiledDocumentWriter::WriteInteger(String& output, uint32_t value)
+{
+	for (int i = 0; i < 4; i++)
+		output += (char)((value >> (8 * i)) & 0xff);
+}
+
+bool CompiledDocumentReader::IsCompiledDocument(const String& source)
+{
+	return source.size() >= sizeof(compiled_document_signature) &&
+		memcmp(source.data(), compiled_document_signature, sizeof(compiled_document_signature)) == 0;
+}
+
+CompiledDocumentReader::CompiledDocumentReader(const String& source) : source(source)
+{
+	uint32_t version = 0, num_strings = 0;
+
+	position = sizeof(compiled_document_signature);
+	if (!IsCompiledDocument(source) || !ReadInteger(version) || version != compiled_document_version)
+	{
+		error = true;
+		return;
+	}
+
+	// Each string is encoded as its length followed by its characters.
+	if (!ReadCount(num_strings, 4))
+		return;
+
+	strings.reserve(num_strings);
+	for (uint32_t i = 0; i < num_strings; i++)
+	{
+		uint32_t length = 0;
+		if (!ReadCount(length, 1))
+			return;
+
+		strings.emplace_back(source, position, length);
+		position += length;
+	}
+
+	if (!ReadInteger(num_nodes_remaining))
+		error = true;
+}
+
+bool CompiledDocumentReader::ReadNode(Node& node)
+{
+	if (error || num_nodes_remaining == 0)
+		return false;
+
+	num_nodes_remaining -= 1;
+
+	uint32_t line_number = 0;
+	if (position >= source.size())
+	{
+		error = true;
+		return false;
+	}
+	node.type = (NodeType)source[position++];
+	if (!ReadInteger(line_number))
+		return false;
+	node.line_number = (int)line_number;
+
+	switch (node.type)
+	{
+	case NodeType::ElementStart:
+	{
+		node.name = ReadString();
+
+		// Each attribute is encoded as the string indices of its name and value.
+		uint32_t num_attributes = 0;
+		if (!ReadCount(num_attributes, 8))
+			return false;
+
+		node.attributes.clear();
+		for (uint32_t i = 0; i < num_attributes && !error; i++)
+		{
+			const String* name = ReadString();
+			const String* value = ReadString();
+			if (name && value)
+				node.attributes[*name] = *value;
+		}
+	}
+	break;
+	case NodeType::ElementEnd:
+	{
+		node.name = ReadString();
+	}
+	break;
+	case NodeType::Data:
+	{
+		if (position >= source.size())
+		{
+			error = true;
+			return false;
+		}
+		const unsigned char data_type = (unsigned char)source[position++];
+		if (data_type > (unsigned char)XMLDataType::InnerXML)
+		{
+			error = true;
+			return false;
+		}
+		node.data_type = (XMLDataType)data_type;
+		node.data = ReadString();
+	}
+	break;
+	default:
+		error = true;
+		break;
+	}
+
+	return !error;
+}
+
+bool CompiledDocumentReader::HasError() const
+{
+	return error;
+}
+
+bool CompiledDocumentReader::ReadInteger(uint32_t& value)
+{
+	if (source.size() - position < 4)
+	{
+		error = true;
+		return false;
+	}
+
+	value = 0;
+	for (int i = 0; i < 4; i++)
+		value |= uint32_t((unsigned char)source[position++]) << (8 * i);
+
+	return true;
+}
+
+bool CompiledDocumentReader::ReadCount(uint32_t& count, size_t min_item_size)
+{
+	if (!ReadInteger(count))
+		return false;
+
+	if (count > (source.size() - position) / min_item_size)
+	{
+		error = true;
+		return false;
+	}
+
+	return true;
+}
+
+const String* CompiledDocumentReader::ReadString()
+{
+	uint32_t index = 0;
+	if (!ReadInteger(index))
+		return nullptr;
+
+	if (index >= strings.size())
+	{
+		error = true;
+		return nullptr;
+	}
+
+	return &strings[index];
+}
+
+} // namespace Rml
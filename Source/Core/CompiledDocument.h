@@ -0,0 +1,115 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_COMPILEDDOCUMENT_H
+#define RMLUI_CORE_COMPILEDDOCUMENT_H
+
+#include "../../Include/RmlUi/Core/BaseXMLParser.h"
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+class Stream;
+
+/**
+	Compiled documents store the nodes of an RML document as they are reported by the XML parser, so that a document
+	which does not change between runs can be instanced without parsing its markup again. Loading a compiled document
+	runs the same node handlers as loading its source, see BaseXMLParser::Parse().
+
+	The document starts with a signature and version, followed by a table of all distinct strings, and then the list
+	of nodes referring to strings by their index in the table. All integers are stored as 32-bit little-endian.
+ */
+
+/// Records the nodes of a document parsed from RML, and encodes them as a compiled document.
+class CompiledDocumentWriter : public BaseXMLParser
+{
+public:
+	CompiledDocumentWriter();
+
+	/// Parses the RML document from the stream, and returns it compiled.
+	String Compile(Stream* stream);
+
+	void HandleElementStart(const String& name, const XMLAttributes& attributes) override;
+	void HandleElementEnd(const String& name) override;
+	void HandleData(const String& data, XMLDataType type) override;
+
+private:
+	// Returns the index of the string in the string table, adding it if needed.
+	uint32_t AddString(const String& string);
+	void WriteInteger(String& output, uint32_t value);
+
+	UnorderedMap<String, uint32_t> string_indices;
+	StringList strings;
+	String nodes;
+	uint32_t num_nodes = 0;
+};
+
+/// Decodes the nodes of a compiled document, in the same order as they were reported by the parser.
+class CompiledDocumentReader
+{
+public:
+	enum class NodeType { ElementStart, ElementEnd, Data };
+
+	struct Node {
+		NodeType type = NodeType::Data;
+		int line_number = 0;
+		const String* name = nullptr;
+		XMLAttributes attributes;
+		const String* data = nullptr;
+		XMLDataType data_type = XMLDataType::Text;
+	};
+
+	/// Returns true if the source starts with the signature of a compiled document.
+	static bool IsCompiledDocument(const String& source);
+
+	/// Reads the string table of the compiled document, which must outlive the reader.
+	CompiledDocumentReader(const String& source);
+
+	/// Reads the next node of the document.
+	/// @return False at the end of the document or if the document is invalid, see HasError().
+	bool ReadNode(Node& node);
+
+	/// Returns true if the document is invalid or of an unsupported version.
+	bool HasError() const;
+
+private:
+	bool ReadInteger(uint32_t& value);
+	// Reads the number of items which follow, rejecting counts that could not fit in the rest of the source.
+	bool ReadCount(uint32_t& count, size_t min_item_size);
+	const String* ReadString();
+
+	const String& source;
+	size_t position = 0;
+	bool error = false;
+
+	StringList strings;
+	uint32_t num_nodes_remaining = 0;
+};
+
+} // namespace Rml
+#endif
@@ -0,0 +1,150 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "CompiledSelector.h"
+#include "../../Include/RmlUi/Core/Element.h"
+
+namespace Rml {
+
+CompiledSelector::CompiledSelector(const String& selectors)
+{
+	leaf_nodes = StyleSheetParser::ConstructNodes(root_node, selectors);
+
+	for (const StyleSheetNode* node : leaf_nodes)
+	{
+		if (!node->id.empty())
+			index_keys.push_back(ElementIndex::Key{ ElementIndex::KeyType::Id, node->id });
+		else if (!node->class_names.empty())
+			index_keys.push_back(ElementIndex::Key{ ElementIndex::KeyType::Class, node->class_names.front() });
+		else
+		{
+			index_keys.clear();
+			break;
+		}
+	}
+}
+
+bool CompiledSelector::IsValid() const
+{
+	return !leaf_nodes.empty();
+}
+
+bool CompiledSelector::Matches(const Element* element) const
+{
+	for (const StyleSheetNode* node : leaf_nodes)
+	{
+		if (node->IsApplicable(element, false))
+			return true;
+	}
+
+	return false;
+}
+
+static Element* QueryFirstRecursive(const CompiledSelector& selector, Element* element)
+{
+	const int num_children = element->GetNumChildren();
+
+	for (int i = 0; i < num_children; i++)
+	{
+		Element* child = element->GetChild(i);
+
+		if (selector.Matches(child))
+			return child;
+
+		Element* matching_element = QueryFirstRecursive(selector, child);
+		if (matching_element)
+			return matching_element;
+	}
+
+	return nullptr;
+}
+
+static void QueryAllRecursive(ElementList& matching_elements, const CompiledSelector& selector, Element* element)
+{
+	const int num_children = element->GetNumChildren();
+
+	for (int i = 0; i < num_children; i++)
+	{
+		Element* child = element->GetChild(i);
+
+		if (selector.Matches(child))
+			matching_elements.push_back(child);
+
+		QueryAllRecursive(matching_elements, selector, child);
+	}
+}
+
+Element* CompiledSelector::QueryFirst(Element* root_element) const
+{
+	ElementList candidates;
+	if (GetIndexedCandidates(candidates, root_element))
+	{
+		for (Element* element : candidates)
+		{
+			if (Matches(element))
+				return element;
+		}
+
+		return nullptr;
+	}
+
+	return QueryFirstRecursive(*this, root_element);
+}
+
+void CompiledSelector::QueryAll(ElementList& elements, Element* root_element) const
+{
+	ElementList candidates;
+	if (GetIndexedCandidates(candidates, root_element))
+	{
+		for (Element* element : candidates)
+		{
+			if (Matches(element))
+				elements.push_back(element);
+		}
+
+		return;
+	}
+
+	QueryAllRecursive(elements, *this, root_element);
+}
+
+bool CompiledSelector::GetIndexedCandidates(ElementList& candidates, Element* root_element) const
+{
+	if (index_keys.empty())
+		return false;
+
+	ElementIndex* index = ElementIndex::GetFor(root_element);
+	if (!index)
+		return false;
+
+	index->GetElementsByKeys(candidates, root_element, index_keys);
+
+	return true;
+}
+
+} // namespace Rml
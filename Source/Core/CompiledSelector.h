@@ -0,0 +1,77 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_COMPILEDSELECTOR_H
+#define RMLUI_CORE_COMPILEDSELECTOR_H
+
+#include "../../Include/RmlUi/Core/Traits.h"
+#include "../../Include/RmlUi/Core/Types.h"
+#include "ElementIndex.h"
+#include "StyleSheetNode.h"
+#include "StyleSheetParser.h"
+
+namespace Rml {
+
+class Element;
+
+/**
+	A list of comma-separated selectors parsed once, to be matched against any number of elements.
+
+	Compiled selectors are immutable once constructed, and are shared through the cache of the style sheet factory.
+ */
+
+class CompiledSelector : public NonCopyMoveable {
+public:
+	CompiledSelector(const String& selectors);
+
+	// Returns false if no selectors could be parsed.
+	bool IsValid() const;
+
+	// Returns true if the element matches any of the selectors.
+	bool Matches(const Element* element) const;
+
+	// Returns the first descendant of the root matching the selectors, in document order.
+	Element* QueryFirst(Element* root_element) const;
+	// Finds all descendants of the root matching the selectors, in document order.
+	void QueryAll(ElementList& elements, Element* root_element) const;
+
+private:
+	// Finds the elements which may match the selectors using the index of the root's document.
+	// @return False if the index can not be used, then every descendant must be tested instead.
+	bool GetIndexedCandidates(ElementList& candidates, Element* root_element) const;
+
+	StyleSheetNode root_node;
+	StyleSheetNodeListRaw leaf_nodes;
+
+	// The index key to look up for each selector. Left empty unless every selector requires an id or a class, which
+	// usually narrow down the candidates considerably.
+	Vector<ElementIndex::Key> index_keys;
+};
+
+} // namespace Rml
+#endif
@@ -38,10 +38,18 @@
 #include "../../Include/RmlUi/Core/StreamMemory.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
 #include "../../Include/RmlUi/Core/StreamMemory.h"
+#include "AnimationTimeline.h"
+#include "Clock.h"
 #include "DataModel.h"
+#include "ElementBackgroundBorder.h"
 #include "EventDispatcher.h"
+#include "FrameStatisticsScope.h"
+#include "GeometryArena.h"
+#include "HitTestGrid.h"
 #include "PluginRegistry.h"
 #include "StreamFile.h"
+#include "TextureDatabase.h"
+#include "WorkerPool.h"
 #include <algorithm>
 #include <iterator>
 
@@ -55,6 +63,9 @@ Context::Context(const String& name) : name(name), dimensions(0, 0), density_ind
 {
 	instancer = nullptr;
 
+	animation_timeline = MakeUnique<AnimationTimeline>();
+	num_render_caches = MakeShared<int>(0);
+
 	// Initialise this to nullptr; this will be set in Rml::CreateContext().
 	render_interface = nullptr;
 
@@ -169,10 +180,15 @@ bool Context::Update()
 {
 	RMLUI_ZoneScoped;
 
+	frame_statistics = FrameStatistics();
+	FrameStatisticsScope statistics_scope(&frame_statistics, &FrameStatistics::update_time);
+
 	// Update all data models first
 	for (auto& data_model : data_models)
 		data_model.second->Update(true);
 
+	animation_timeline->Update(Clock::GetElapsedTime());
+
 	root->Update(density_independent_pixel_ratio, Vector2f(dimensions));
 
 	for (int i = 0; i < root->GetNumChildren(); ++i)
@@ -197,7 +213,32 @@ bool Context::Render()
 	if (render_interface == nullptr)
 		return false;
 
+	FrameStatisticsScope statistics_scope(&frame_statistics, &FrameStatistics::render_time);
+
 	render_interface->context = this;
+	render_pass = ++render_pass_counter;
+	if (render_pass == 0)
+		render_pass = ++render_pass_counter;
+
+	// Rendering this context again means every context has had its turn in the frame, so textures used by any of them are kept.
+	if (texture_frame == TextureDatabase::GetFrame())
+		TextureDatabase::EvictTextures();
+	texture_frame = TextureDatabase::GetFrame();
+
+	// Upload any textures loaded in the background, elements in every context may be waiting for them.
+	Vector<ObserverPtr<Element>> waiting_elements;
+	if (TextureDatabase::UploadLoadedTextures(render_interface, waiting_elements) > 0)
+	{
+		for (ObserverPtr<Element>& element : waiting_elements)
+		{
+			if (element)
+				element->NotifyTexturesLoaded();
+		}
+	}
+
+	if (geometry_workers)
+		PrepareGeometry();
+
 	ElementUtilities::ApplyActiveClipRegion(this, render_interface);
 
 	root->Render();
@@ -214,11 +255,95 @@ bool Context::Render()
 		cursor_proxy->Render();
 	}
 
+	render_interface->ApplyOpacity(1.f);
 	render_interface->context = nullptr;
+	render_pass = 0;
 
 	return true;
 }
 
+void Context::EnableGeometryArena(bool enable)
+{
+	if (enable && !geometry_arena)
+		geometry_arena = MakeUnique<GeometryArena>();
+	else if (!enable)
+		geometry_arena.reset();
+}
+
+void Context::SetNumGeometryWorkers(int num_workers)
+{
+	const int current_num_workers = (geometry_workers ? geometry_workers->GetNumWorkers() : 0);
+	if (num_workers == current_num_workers)
+		return;
+
+	geometry_workers.reset();
+
+	for (const ObserverPtr<Element>& element : dirty_background_border_elements)
+	{
+		if (element)
+			element->GetBackgroundBorder().prepare_queued = false;
+	}
+	dirty_background_border_elements.clear();
+	if (num_workers > 0)
+		geometry_workers = MakeUnique<WorkerPool>(num_workers);
+}
+
+void Context::PrepareGeometry()
+{
+	RMLUI_ZoneScoped;
+
+	// Gather the elements that are still dirty and displayed, any others are left to be generated during rendering if needed.
+	ElementList elements;
+	for (const ObserverPtr<Element>& observer : dirty_background_border_elements)
+	{
+		Element* element = observer.get();
+		if (!element)
+			continue;
+
+		ElementBackgroundBorder& background_border = element->GetBackgroundBorder();
+		background_border.prepare_queued = false;
+
+		if (!background_border.IsDirty() || element->GetContext() != this)
+			continue;
+
+		bool displayed = true;
+		for (Element* ancestor = element; ancestor && displayed; ancestor = ancestor->GetParentNode())
+			displayed = (ancestor->GetComputedValues().display != Style::Display::None);
+
+		if (displayed)
+			elements.push_back(element);
+	}
+	dirty_background_border_elements.clear();
+
+	if (elements.empty())
+		return;
+
+	struct GeometryBuffers {
+		Vector<Vertex> vertices;
+		Vector<int> indices;
+	};
+	Vector<GeometryBuffers> buffers(elements.size());
+
+	// The workers only read from the elements and write to their own buffers, the geometry itself is replaced afterwards on this thread.
+	geometry_workers->ParallelFor((int)elements.size(), [&](int i) {
+		ElementBackgroundBorder::GenerateGeometry(elements[i], buffers[i].vertices, buffers[i].indices);
+	});
+
+	for (size_t i = 0; i < elements.size(); i++)
+		elements[i]->GetBackgroundBorder().SetGeometry(std::move(buffers[i].vertices), std::move(buffers[i].indices));
+}
+
+void Context::DirtyBackgroundBorder(Element* element)
+{
+	if (geometry_workers)
+		dirty_background_border_elements.push_back(element->GetObserverPtr());
+}
+
+const FrameStatistics& Context::GetFrameStatistics() const
+{
+	return frame_statistics;
+}
+
 // Creates a new, empty document and places it into this context. 
 ElementDocument* Context::CreateDocument(const String& instancer_name)
 {
@@ -562,12 +687,15 @@ bool Context::ProcessMouseMove(int x, int y, int key_modifier_state)
 		mouse_position.y = y;
 	}
 
-	// Generate the parameters for the mouse events (there could be a few!).
-	Dictionary parameters;
+	// Generate the parameters for the mouse events (there could be a few!). The dictionaries are moved in and out of
+	// the context so that their memory is reused between calls, while staying safe if we are called recursively.
+	Dictionary parameters = std::move(mouse_move_parameters);
+	parameters.clear();
 	GenerateMouseEventParameters(parameters, -1);
 	GenerateKeyModifierEventParameters(parameters, key_modifier_state);
 
-	Dictionary drag_parameters;
+	Dictionary drag_parameters = std::move(drag_move_parameters);
+	drag_parameters.clear();
 	GenerateMouseEventParameters(drag_parameters);
 	GenerateDragEventParameters(drag_parameters);
 	GenerateKeyModifierEventParameters(drag_parameters, key_modifier_state);
@@ -589,6 +717,9 @@ bool Context::ProcessMouseMove(int x, int y, int key_modifier_state)
 		}
 	}
 
+	mouse_move_parameters = std::move(parameters);
+	drag_move_parameters = std::move(drag_parameters);
+
 	return !IsMouseInteracting();
 }
 	
@@ -870,6 +1001,9 @@ bool Context::RemoveDataModel(const String& name)
 // Internal callback for when an element is removed from the hierarchy.
 void Context::OnElementDetach(Element* element)
 {
+	if (element->in_animation_timeline)
+		animation_timeline->RemoveElement(element);
+
 	auto it_hover = hover_chain.find(element);
 	if (it_hover != hover_chain.end())
 	{
@@ -1050,8 +1184,9 @@ void Context::UpdateHoverChain(const Dictionary& parameters, const Dictionary& d
 		}
 	}
 
-	// Build the new hover chain.
-	ElementSet new_hover_chain;
+	// Build the new hover chain, reusing the memory of a previous chain.
+	ElementSet new_hover_chain = std::move(unused_hover_chain);
+	new_hover_chain.clear();
 	Element* element = hover;
 	while (element != nullptr)
 	{
@@ -1068,7 +1203,8 @@ void Context::UpdateHoverChain(const Dictionary& parameters, const Dictionary& d
 	{
 		drag_hover = GetElementAtPoint(position, drag);
 
-		ElementSet new_drag_hover_chain;
+		ElementSet new_drag_hover_chain = std::move(unused_drag_hover_chain);
+		new_drag_hover_chain.clear();
 		element = drag_hover;
 		while (element != nullptr)
 		{
@@ -1085,10 +1221,12 @@ void Context::UpdateHoverChain(const Dictionary& parameters, const Dictionary& d
 		}
 
 		drag_hover_chain.swap(new_drag_hover_chain);
+		unused_drag_hover_chain = std::move(new_drag_hover_chain);
 	}
 
 	// Swap the new chain in.
 	hover_chain.swap(new_hover_chain);
+	unused_hover_chain = std::move(new_hover_chain);
 }
 
 // Returns the youngest descendent of the given element which is under the given point in screen coodinates.
@@ -1124,8 +1262,7 @@ Element* Context::GetElementAtPoint(Vector2f point, const Element* ignore_elemen
 		if (element->stacking_context_dirty)
 			element->BuildLocalStackingContext();
 
-		for (int i = (int) element->stacking_context.size() - 1; i >= 0; --i)
-		{
+		auto test_child = [&](int i) -> Element* {
 			if (ignore_element != nullptr)
 			{
 				Element* element_hierarchy = element->stacking_context[i];
@@ -1138,12 +1275,34 @@ Element* Context::GetElementAtPoint(Vector2f point, const Element* ignore_elemen
 				}
 
 				if (element_hierarchy != nullptr)
-					continue;
+					return nullptr;
 			}
 
-			Element* child_element = GetElementAtPoint(point, ignore_element, element->stacking_context[i]);
-			if (child_element != nullptr)
-				return child_element;
+			return GetElementAtPoint(point, ignore_element, element->stacking_context[i]);
+		};
+
+		if ((int)element->stacking_context.size() >= HitTestGrid::MinNumElements)
+		{
+			// Large stacking contexts are narrowed down to the elements overlapping the point, in the same order as below.
+			if (!element->hit_test_grid)
+				element->hit_test_grid = MakeUnique<HitTestGrid>();
+
+			HitTestGrid& grid = *element->hit_test_grid;
+			grid.Update(element->stacking_context);
+
+			for (int i : grid.QueryPoint(point))
+			{
+				if (Element* child_element = test_child(i))
+					return child_element;
+			}
+		}
+		else
+		{
+			for (int i = (int) element->stacking_context.size() - 1; i >= 0; --i)
+			{
+				if (Element* child_element = test_child(i))
+					return child_element;
+			}
 		}
 	}
 
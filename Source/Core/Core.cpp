@@ -37,10 +37,12 @@
 #include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
 #include "../../Include/RmlUi/Core/Types.h"
 
+#include "CompiledDocument.h"
 #include "EventSpecification.h"
 #include "FileInterfaceDefault.h"
 #include "GeometryDatabase.h"
 #include "PluginRegistry.h"
+#include "StreamFile.h"
 #include "StyleSheetFactory.h"
 #include "StyleSheetParser.h"
 #include "TemplateCache.h"
@@ -350,6 +352,37 @@ void ReleaseTextures()
 	TextureDatabase::ReleaseTextures();
 }
 
+void SetTextureAtlas(int max_image_size, int page_size)
+{
+	TextureDatabase::SetAtlas(max_image_size, page_size);
+}
+
+void SetAsyncTextureLoading(const TextureDecoder& decoder, int max_uploads_per_frame, const TextureLoadedCallback& loaded_callback)
+{
+	TextureDatabase::SetAsyncLoading(decoder, max_uploads_per_frame, loaded_callback);
+}
+
+void SetTextureMemoryBudget(size_t memory_budget)
+{
+	TextureDatabase::SetMemoryBudget(memory_budget);
+}
+
+TextureStatistics GetTextureStatistics()
+{
+	return TextureDatabase::GetStatistics();
+}
+
+bool CompileDocument(const String& document_path, String& compiled_document)
+{
+	StreamFile stream;
+	if (!stream.Open(document_path))
+		return false;
+
+	CompiledDocumentWriter writer;
+	compiled_document = writer.Compile(&stream);
+	return true;
+}
+
 void ReleaseCompiledGeometry()
 {
 	return GeometryDatabase::ReleaseAll();
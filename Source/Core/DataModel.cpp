@@ -129,6 +129,14 @@ DataModel::DataModel(const TransformFuncRegister* transform_register) : transfor
 DataModel::~DataModel()
 {
 	RMLUI_ASSERT(attached_elements.empty());
+
+	PostedUpdate* update = posted_updates.exchange(nullptr);
+	while (update)
+	{
+		PostedUpdate* next = update->next;
+		delete update;
+		update = next;
+	}
 }
 
 void DataModel::AddView(DataViewPtr view) {
@@ -161,6 +169,9 @@ bool DataModel::BindVariable(const String& name, DataVariable variable)
 		return false;
 	}
 
+	if (change_detection)
+		AddVariableSnapshot(name, variable);
+
 	return true;
 }
 
@@ -366,8 +377,94 @@ void DataModel::OnElementRemove(Element* element)
 	attached_elements.erase(element);
 }
 
+void DataModel::SetChangeDetection(bool enable)
+{
+	if (enable == change_detection)
+		return;
+
+	change_detection = enable;
+	variable_snapshots.clear();
+
+	if (change_detection)
+	{
+		for (auto& name_variable : variables)
+			AddVariableSnapshot(name_variable.first, name_variable.second);
+	}
+}
+
+void DataModel::AddVariableSnapshot(const String& name, DataVariable variable)
+{
+	// Only scalar values are cheap enough to compare, arrays and structs must be dirtied manually.
+	const DataVariableType type = variable.Type();
+	if (type != DataVariableType::Scalar && type != DataVariableType::Function)
+		return;
+
+	VariableSnapshot snapshot;
+	snapshot.name = name;
+	snapshot.variable = variable;
+	snapshot.variable.Get(snapshot.value);
+
+	variable_snapshots.push_back(std::move(snapshot));
+}
+
+void DataModel::DirtyChangedVariables()
+{
+	Variant value;
+	for (VariableSnapshot& snapshot : variable_snapshots)
+	{
+		if (snapshot.variable.Get(value) && value != snapshot.value)
+		{
+			dirty_variables.emplace(snapshot.name);
+			snapshot.value = std::move(value);
+		}
+	}
+}
+
+void DataModel::PostVariableUpdate(const String& address_str, const Variant& value)
+{
+	PostedUpdate* update = new PostedUpdate{ address_str, value, posted_updates.load(std::memory_order_relaxed) };
+	while (!posted_updates.compare_exchange_weak(update->next, update, std::memory_order_release, std::memory_order_relaxed))
+	{}
+}
+
+void DataModel::ApplyPostedUpdates()
+{
+	PostedUpdate* update = posted_updates.exchange(nullptr, std::memory_order_acquire);
+
+	// The updates are stacked in reverse order of posting, reverse them so that the last posted value wins.
+	PostedUpdate* ordered_update = nullptr;
+	while (update)
+	{
+		PostedUpdate* next = update->next;
+		update->next = ordered_update;
+		ordered_update = update;
+		update = next;
+	}
+
+	while (ordered_update)
+	{
+		const DataAddress address = ParseAddress(ordered_update->address);
+		DataVariable variable = GetVariable(address);
+
+		if (variable && variable.Set(ordered_update->value))
+			dirty_variables.emplace(address.front().name);
+		else
+			Log::Message(Log::LT_WARNING, "Could not apply posted update to data variable '%s'.", ordered_update->address.c_str());
+
+		PostedUpdate* next = ordered_update->next;
+		delete ordered_update;
+		ordered_update = next;
+	}
+}
+
 bool DataModel::Update(bool clear_dirty_variables)
 {
+	if (posted_updates.load(std::memory_order_relaxed))
+		ApplyPostedUpdates();
+
+	if (change_detection)
+		DirtyChangedVariables();
+
 	const bool result = views->Update(*this, dirty_variables);
 
 	if (clear_dirty_variables)
@@ -34,6 +34,7 @@
 #include "../../Include/RmlUi/Core/Traits.h"
 #include "../../Include/RmlUi/Core/DataTypes.h"
 #include "../../Include/RmlUi/Core/DataVariable.h"
+#include <atomic>
 
 namespace Rml {
 
@@ -75,9 +76,23 @@ public:
 
 	void OnElementRemove(Element* element);
 
+	// Enables automatic change detection for scalar variables, see 'DataModelConstructor::SetChangeDetection'.
+	void SetChangeDetection(bool enable);
+
+	// Queues a new value for the variable at the given address, to be applied and dirtied on the next update. Thread-safe.
+	void PostVariableUpdate(const String& address_str, const Variant& value);
+
 	bool Update(bool clear_dirty_variables);
 
 private:
+	// Applies all values posted from any thread since the last call, in the order they were posted.
+	void ApplyPostedUpdates();
+
+	// Takes a snapshot of the variable's value if it is eligible for change detection.
+	void AddVariableSnapshot(const String& name, DataVariable variable);
+	// Dirties all snapshot variables whose value has changed since the previous call, and updates their snapshots.
+	void DirtyChangedVariables();
+
 	UniquePtr<DataViews> views;
 	UniquePtr<DataControllers> controllers;
 
@@ -93,6 +108,23 @@ private:
 	const TransformFuncRegister* transform_register;
 
 	SmallUnorderedSet<Element*> attached_elements;
+
+	struct VariableSnapshot {
+		String name;
+		DataVariable variable;
+		Variant value;
+	};
+
+	bool change_detection = false;
+	Vector<VariableSnapshot> variable_snapshots;
+
+	// Lock-free, multi-producer stack of posted updates. Consumed in bulk on the thread updating the model.
+	struct PostedUpdate {
+		String address;
+		Variant value;
+		PostedUpdate* next;
+	};
+	std::atomic<PostedUpdate*> posted_updates{ nullptr };
 };
 
 
@@ -43,6 +43,10 @@ void DataModelHandle::DirtyVariable(const String& variable_name) {
 	model->DirtyVariable(variable_name);
 }
 
+void DataModelHandle::PostVariableUpdate(const String& variable_address, const Variant& value) {
+	model->PostVariableUpdate(variable_address, value);
+}
+
 
 DataModelConstructor::DataModelConstructor() : model(nullptr), type_register(nullptr) {}
 
@@ -62,6 +66,10 @@ bool DataModelConstructor::BindEventCallback(const String& name, DataEventFunc e
 	return model->BindEventCallback(name, std::move(event_func));
 }
 
+void DataModelConstructor::SetChangeDetection(bool enable) {
+	model->SetChangeDetection(enable);
+}
+
 bool DataModelConstructor::BindVariable(const String& name, DataVariable data_variable) {
 	return model->BindVariable(name, data_variable);
 }
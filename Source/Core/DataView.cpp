@@ -28,7 +28,6 @@
 
 #include "DataView.h"
 #include "../../Include/RmlUi/Core/Element.h"
-#include <algorithm>
 
 namespace Rml {
 
@@ -72,17 +71,84 @@ void DataViews::Add(DataViewPtr view) {
 
 void DataViews::OnElementRemove(Element* element) 
 {
-	for (auto it = views.begin(); it != views.end();)
+	auto range = views.equal_range(element);
+	if (range.first == range.second)
+		return;
+
+	for (auto it = range.first; it != range.second; ++it)
+	{
+		// The view may currently be queued for update, thus we keep it alive until the end of the current update.
+		Unregister(it->second.get());
+		views_to_remove.push_back(std::move(it->second));
+	}
+
+	views.erase(range.first, range.second);
+}
+
+void DataViews::Register(DataView* view)
+{
+	RMLUI_ASSERT(!view->is_registered);
+	view->is_registered = true;
+
+	for (const String& variable_name : view->GetVariableNameList())
+	{
+		auto result = name_index_map.emplace(variable_name, (int)name_view_lists.size());
+		if (result.second)
+			name_view_lists.emplace_back();
+
+		const int list_index = result.first->second;
+		Vector<DataView*>& list = name_view_lists[list_index];
+
+		view->registrations.push_back(DataView::Registration{ list_index, (int)list.size() });
+		list.push_back(view);
+	}
+}
+
+void DataViews::Unregister(DataView* view)
+{
+	if (!view->is_registered)
+		return;
+
+	for (const DataView::Registration& registration : view->registrations)
 	{
-		auto& view = *it;
-		if (view && view->GetElement() == element)
+		Vector<DataView*>& list = name_view_lists[registration.list_index];
+		RMLUI_ASSERT(registration.position < (int)list.size() && list[registration.position] == view);
+
+		// Swap-remove the view, then update the handle of the view which took its place.
+		const int last_position = (int)list.size() - 1;
+		DataView* moved_view = list[last_position];
+		list[registration.position] = moved_view;
+		list.pop_back();
+
+		if (registration.position != last_position)
 		{
-			views_to_remove.push_back(std::move(view));
-			it = views.erase(it);
+			for (DataView::Registration& moved_registration : moved_view->registrations)
+			{
+				if (moved_registration.list_index == registration.list_index && moved_registration.position == last_position)
+				{
+					moved_registration.position = registration.position;
+					break;
+				}
+			}
 		}
-		else
-			++it;
 	}
+
+	view->registrations.clear();
+	view->is_registered = false;
+}
+
+void DataViews::MarkDirty(DataView* view)
+{
+	if (view->is_dirty)
+		return;
+
+	view->is_dirty = true;
+
+	const size_t depth = (size_t)view->GetElementDepth();
+	if (depth >= dirty_views_by_depth.size())
+		dirty_views_by_depth.resize(depth + 1);
+
+	dirty_views_by_depth[depth].push_back(view);
 }
 
 bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables)
@@ -93,65 +159,49 @@ bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables)
 	//   Without the loop, newly added views won't be updated until the next Update() call.
 	for(int i = 0; i == 0 || (!views_to_add.empty() && i < 10); i++)
 	{
-		Vector<DataView*> dirty_views;
-
 		if (!views_to_add.empty())
 		{
-			views.reserve(views.size() + views_to_add.size());
 			for (auto&& view : views_to_add)
 			{
-				dirty_views.push_back(view.get());
-				for (const String& variable_name : view->GetVariableNameList())
-					name_view_map.emplace(variable_name, view.get());
+				DataView* view_ptr = view.get();
+				Register(view_ptr);
+				MarkDirty(view_ptr);
 
-				views.push_back(std::move(view));
+				Element* element = view_ptr->attached_element.get();
+				views.emplace(element, std::move(view));
 			}
 			views_to_add.clear();
 		}
 
 		for (const String& variable_name : dirty_variables)
 		{
-			auto pair = name_view_map.equal_range(variable_name);
-			for (auto it = pair.first; it != pair.second; ++it)
-				dirty_views.push_back(it->second);
+			auto it = name_index_map.find(variable_name);
+			if (it != name_index_map.end())
+			{
+				for (DataView* view : name_view_lists[it->second])
+					MarkDirty(view);
+			}
 		}
 
-		// Remove duplicate entries
-		std::sort(dirty_views.begin(), dirty_views.end());
-		auto it_remove = std::unique(dirty_views.begin(), dirty_views.end());
-		dirty_views.erase(it_remove, dirty_views.end());
-
-		// Sort by the element's depth in the document tree so that any structural changes due to a changed variable are reflected in the element's children.
+		// Update in order of the element's depth in the document tree so that any structural changes due to a changed variable are reflected in the element's children.
 		// Eg. the 'data-for' view will remove children if any of its data variable array size is reduced.
-		std::sort(dirty_views.begin(), dirty_views.end(), [](auto&& left, auto&& right) { return left->GetElementDepth() < right->GetElementDepth(); });
-
-		for (DataView* view : dirty_views)
-		{
-			RMLUI_ASSERT(view);
-			if (!view)
-				continue;
-
-			if (view->IsValid())
-				result |= view->Update(model);
-		}
-
-		// Destroy views marked for destruction
-		// @performance: Horrible...
-		if (!views_to_remove.empty())
+		for (Vector<DataView*>& dirty_views : dirty_views_by_depth)
 		{
-			for (const auto& view : views_to_remove)
+			for (DataView* view : dirty_views)
 			{
-				for (auto it = name_view_map.begin(); it != name_view_map.end(); )
-				{
-					if (it->second == view.get())
-						it = name_view_map.erase(it);
-					else
-						++it;
-				}
+				RMLUI_ASSERT(view);
+				view->is_dirty = false;
+
+				// Views can be removed by the update of views at a lower depth, skip them in that case.
+				if (view->is_registered && view->IsValid())
+					result |= view->Update(model);
 			}
 
-			views_to_remove.clear();
+			dirty_views.clear();
 		}
+
+		// Destroy views marked for destruction
+		views_to_remove.clear();
 	}
 
 	return result;
@@ -100,6 +100,17 @@ protected:
 private:
 	ObserverPtr<Element> attached_element;
 	int element_depth;
+
+	// Registration handles managed by DataViews, allowing the view to be removed from its variable lists in constant time.
+	struct Registration {
+		int list_index;
+		int position;
+	};
+	Vector<Registration> registrations;
+	bool is_registered = false;
+	bool is_dirty = false;
+
+	friend class DataViews;
 };
 
 
@@ -116,15 +127,26 @@ public:
 	bool Update(DataModel& model, const DirtyVariables& dirty_variables);
 
 private:
-	using DataViewList = Vector<DataViewPtr>;
+	void Register(DataView* view);
+	void Unregister(DataView* view);
 
-	DataViewList views;
-	
+	// Queue the view for update unless it is already queued.
+	void MarkDirty(DataView* view);
+
+	using ElementViewsMap = UnorderedMultimap<Element*, DataViewPtr>;
+	ElementViewsMap views;
+
+	using DataViewList = Vector<DataViewPtr>;
 	DataViewList views_to_add;
 	DataViewList views_to_remove;
 
-	using NameViewMap = UnorderedMultimap<String, DataView*>;
-	NameViewMap name_view_map;
+	// Maps each variable name to an index into 'name_view_lists', the list of views depending on the given variable.
+	using NameIndexMap = UnorderedMap<String, int>;
+	NameIndexMap name_index_map;
+	Vector<Vector<DataView*>> name_view_lists;
+
+	// Dirty views bucketed by their element's depth in the document tree.
+	Vector<Vector<DataView*>> dirty_views_by_depth;
 };
 
 } // namespace Rml
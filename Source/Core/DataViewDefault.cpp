@@ -33,6 +33,8 @@
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/ElementText.h"
 #include "../../Include/RmlUi/Core/Factory.h"
+#include "../../Include/RmlUi/Core/PropertyDictionary.h"
+#include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
 #include "../../Include/RmlUi/Core/Variant.h"
 
@@ -92,8 +94,10 @@ bool DataViewAttribute::Update(DataModel& model)
 	{
 		const String value = variant.Get<String>();
 		const Variant* attribute = element->GetAttribute(attribute_name);
-		
-		if (!attribute || (attribute && attribute->Get<String>() != value))
+
+		// Attributes are normally stored as strings, compare by reference to avoid a copy in the common case.
+		const bool is_equal = attribute && (attribute->GetType() == Variant::STRING ? attribute->GetReference<String>() == value : attribute->Get<String>() == value);
+		if (!is_equal)
 		{
 			element->SetAttribute(attribute_name, value);
 			result = true;
@@ -187,12 +191,24 @@ bool DataViewStyle::Update(DataModel& model)
 	
 	if (element && GetExpression().Run(expr_interface, variant))
 	{
+		// The string representation of a parsed property generally differs from the input string, eg. for lengths and shorthands.
+		// Thus, compare the parsed properties against the element's current values, and only set those that differ.
 		const String value = variant.Get<String>();
-		const Property* p = element->GetLocalProperty(property_name);
-		if (!p || p->Get<String>() != value)
+		PropertyDictionary properties;
+		if (!StyleSheetSpecification::ParsePropertyDeclaration(properties, property_name, value))
 		{
-			element->SetProperty(property_name, value);
-			result = true;
+			Log::Message(Log::LT_WARNING, "Syntax error parsing inline property declaration '%s: %s;'.", property_name.c_str(), value.c_str());
+			return false;
+		}
+
+		for (const auto& property : properties.GetProperties())
+		{
+			const Property* current = element->GetLocalProperty(property.first);
+			if (!current || !(*current == property.second))
+			{
+				element->SetProperty(property.first, property.second);
+				result = true;
+			}
 		}
 	}
 	return result;
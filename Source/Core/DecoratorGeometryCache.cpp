@@ -0,0 +1,135 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "DecoratorGeometryCache.h"
+#include "Utilities.h"
+#include "../../Include/RmlUi/Core/ComputedValues.h"
+#include "../../Include/RmlUi/Core/Context.h"
+#include "../../Include/RmlUi/Core/Element.h"
+#include <string.h>
+
+namespace Rml {
+
+DecoratorGeometryKey::DecoratorGeometryKey(const Decorator* decorator, Element* element) :
+	decorator(decorator), context(element->GetContext()), owner(element->GetComputedValues().opacity < 1.f ? element : nullptr)
+{}
+
+DecoratorGeometryKey& DecoratorGeometryKey::Add(float value)
+{
+	RMLUI_ASSERTMSG(num_values < MaxNumValues, "Too many values in decorator geometry key.");
+	if (num_values < MaxNumValues)
+		values[num_values++] = value;
+	return *this;
+}
+
+DecoratorGeometryKey& DecoratorGeometryKey::Add(Vector2f value)
+{
+	return Add(value.x).Add(value.y);
+}
+
+DecoratorGeometryKey& DecoratorGeometryKey::Add(Colourb value)
+{
+	uint32_t bits = (uint32_t(value.red) << 24) | (uint32_t(value.green) << 16) | (uint32_t(value.blue) << 8) | uint32_t(value.alpha);
+	float value_float;
+	memcpy(&value_float, &bits, sizeof(float));
+	return Add(value_float);
+}
+
+bool DecoratorGeometryKey::operator==(const DecoratorGeometryKey& other) const
+{
+	// Values are compared bitwise, so that colours are never mistaken for each other by floating-point comparison.
+	return decorator == other.decorator && context == other.context && owner == other.owner && num_values == other.num_values &&
+		memcmp(values.data(), other.values.data(), num_values * sizeof(float)) == 0;
+}
+
+DecoratorGeometryCache::SharedGeometry DecoratorGeometryCache::Acquire(const Key& key, int num_geometry, const GenerateFunction& generate)
+{
+	UniquePtr<GeometryList> new_geometry = MakeUnique<GeometryList>();
+	new_geometry->reserve(num_geometry);
+	for (int i = 0; i < num_geometry; i++)
+		new_geometry->emplace_back(key.context);
+
+	// Without a context there is nothing to share the geometry with.
+	if (!key.context)
+	{
+		generate(*new_geometry);
+		return SharedGeometry(std::move(new_geometry));
+	}
+
+	SharedPtr<DecoratorGeometryCache>& cache = key.context->decorator_geometry_cache;
+	if (!cache)
+		cache = MakeShared<DecoratorGeometryCache>();
+
+	auto it = cache->geometry_cache.find(key);
+	if (it != cache->geometry_cache.end())
+	{
+		if (SharedGeometry geometry = it->second.lock())
+			return geometry;
+	}
+
+	generate(*new_geometry);
+
+	// The geometry may outlive the context and its cache, such as when held by an element removed from the context.
+	WeakPtr<DecoratorGeometryCache> weak_cache = cache;
+	SharedGeometry geometry(new_geometry.release(), [key, weak_cache](GeometryList* geometry_list) {
+		if (SharedPtr<DecoratorGeometryCache> cache = weak_cache.lock())
+			cache->geometry_cache.erase(key);
+		delete geometry_list;
+	});
+
+	cache->geometry_cache[key] = geometry;
+
+	return geometry;
+}
+
+#ifdef RMLUI_TESTS_ENABLED
+int DecoratorGeometryCache::GetNumEntries(Context* context)
+{
+	const SharedPtr<DecoratorGeometryCache>& cache = context->decorator_geometry_cache;
+	return cache ? (int)cache->geometry_cache.size() : 0;
+}
+#endif
+
+} // namespace Rml
+
+namespace std {
+size_t hash<::Rml::DecoratorGeometryKey>::operator() (const ::Rml::DecoratorGeometryKey& key) const
+{
+	size_t seed = 0;
+	::Rml::Utilities::HashCombine(seed, key.decorator);
+	::Rml::Utilities::HashCombine(seed, key.context);
+	::Rml::Utilities::HashCombine(seed, key.owner);
+	for (int i = 0; i < key.num_values; i++)
+	{
+		uint32_t bits;
+		memcpy(&bits, &key.values[i], sizeof(float));
+		::Rml::Utilities::HashCombine(seed, bits);
+	}
+	return seed;
+}
+}
@@ -0,0 +1,108 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_DECORATORGEOMETRYCACHE_H
+#define RMLUI_CORE_DECORATORGEOMETRYCACHE_H
+
+#include "../../Include/RmlUi/Core/Geometry.h"
+#include "../../Include/RmlUi/Core/Traits.h"
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+class Context;
+class Decorator;
+class Element;
+
+// Identifies the geometry generated by a decorator for an element.
+struct DecoratorGeometryKey {
+	DecoratorGeometryKey(const Decorator* decorator, Element* element);
+
+	// Adds a value that the decorator's geometry is generated from.
+	DecoratorGeometryKey& Add(float value);
+	DecoratorGeometryKey& Add(Vector2f value);
+	DecoratorGeometryKey& Add(Colourb value);
+
+	bool operator==(const DecoratorGeometryKey& other) const;
+
+	const Decorator* decorator;
+	Context* context;
+	// Set for translucent elements, which don't share their geometry.
+	const Element* owner;
+
+	static constexpr int MaxNumValues = 16;
+	int num_values = 0;
+	Array<float, MaxNumValues> values = {};
+};
+
+} // namespace Rml
+
+namespace std {
+template <> struct hash<::Rml::DecoratorGeometryKey> {
+	size_t operator() (const ::Rml::DecoratorGeometryKey& key) const;
+};
+}
+
+namespace Rml {
+
+/**
+	The decorator geometry cache shares the geometry generated by decorators between elements that would otherwise
+	generate identical geometry, such as equally sized slots in a grid.
+
+	Each context owns its own cache. Geometry is identified by its decorator and the element values it is generated
+	from. It is reference counted, and removed from the cache when the last element using it releases it.
+
+	Translucent elements are not shared, so that they each keep their own copy of the geometry with their opacity applied.
+*/
+
+class DecoratorGeometryCache : public NonCopyMoveable
+{
+public:
+	using Key = DecoratorGeometryKey;
+	using SharedGeometry = SharedPtr<GeometryList>;
+	using GenerateFunction = Function<void(GeometryList& geometry)>;
+
+	/// Returns the geometry generated for the given key, or generates it if it is not in use by any other element.
+	/// @param[in] key The key identifying the geometry.
+	/// @param[in] num_geometry The number of geometries to create, hosted by the key's context, when generating.
+	/// @param[in] generate Fills the newly created geometry, only called on a cache miss.
+	/// @return The shared geometry, released from the cache when the last reference to it is dropped.
+	static SharedGeometry Acquire(const Key& key, int num_geometry, const GenerateFunction& generate);
+
+#ifdef RMLUI_TESTS_ENABLED
+	// Returns the number of distinct geometries currently in use in the given context.
+	static int GetNumEntries(Context* context);
+#endif
+
+private:
+	// The geometry currently in use. Entries are erased by the deleter of the shared geometry, so they never expire while in the map.
+	UnorderedMap<Key, WeakPtr<GeometryList>> geometry_cache;
+};
+
+} // namespace Rml
+#endif
@@ -27,6 +27,7 @@
  */
 
 #include "DecoratorGradient.h"
+#include "DecoratorGeometryCache.h"
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/ElementUtilities.h"
 #include "../../Include/RmlUi/Core/Geometry.h"
@@ -66,11 +67,8 @@ bool DecoratorGradient::Initialise(const Direction dir_, const Colourb start_, c
 
 DecoratorDataHandle DecoratorGradient::GenerateElementData(Element* element) const
 {
-	Geometry* geometry = new Geometry(element);
 	const Box& box = element->GetBox();
-
 	const ComputedValues& computed = element->GetComputedValues();
-	const float opacity = computed.opacity;
 
 	const Vector4f border_radius{
 		computed.border_top_left_radius,
@@ -78,48 +76,57 @@ DecoratorDataHandle DecoratorGradient::GenerateElementData(Element* element) con
 		computed.border_bottom_right_radius,
 		computed.border_bottom_left_radius,
 	};
-	GeometryUtilities::GenerateBackgroundBorder(geometry, element->GetBox(), Vector2f(0), border_radius, Colourb());
 
-	// Apply opacity
-	Colourb colour_start = start;
-	colour_start.alpha = (byte)(opacity * (float)colour_start.alpha);
-	Colourb colour_stop = stop;
-	colour_stop.alpha = (byte)(opacity * (float)colour_stop.alpha);
+	// The geometry is generated in border-box coordinates, thus it only depends on the box sizes and radii.
+	DecoratorGeometryCache::Key key(this, element);
+	key.Add(box.GetSize());
+	for (int area = Box::BORDER; area <= Box::PADDING; area++)
+	{
+		for (int edge = 0; edge < 4; edge++)
+			key.Add(box.GetEdge(Box::Area(area), Box::Edge(edge)));
+	}
+	for (int i = 0; i < 4; i++)
+		key.Add(border_radius[i]);
 
-	const Vector2f padding_offset = box.GetPosition(Box::PADDING);
-	const Vector2f padding_size = box.GetSize(Box::PADDING);
+	auto data = new DecoratorGeometryCache::SharedGeometry(DecoratorGeometryCache::Acquire(key, 1, [&](GeometryList& geometry_list) {
+		Geometry& geometry = geometry_list[0];
+		GeometryUtilities::GenerateBackgroundBorder(&geometry, box, Vector2f(0), border_radius, Colourb());
 
-	Vector<Vertex>& vertices = geometry->GetVertices();
+		const Vector2f padding_offset = box.GetPosition(Box::PADDING);
+		const Vector2f padding_size = box.GetSize(Box::PADDING);
 
-	if (dir == Direction::Horizontal)
-	{
-		for (int i = 0; i < (int)vertices.size(); i++)
+		Vector<Vertex>& vertices = geometry.GetVertices();
+
+		if (dir == Direction::Horizontal)
 		{
-			const float t = (vertices[i].position.x - padding_offset.x) / padding_size.x;
-			vertices[i].colour = Math::Lerp(Math::Clamp(t, 0.0f, 1.0f), colour_start, colour_stop);
+			for (int i = 0; i < (int)vertices.size(); i++)
+			{
+				const float t = (vertices[i].position.x - padding_offset.x) / padding_size.x;
+				vertices[i].colour = Math::Lerp(Math::Clamp(t, 0.0f, 1.0f), start, stop);
+			}
 		}
-	}
-	else if (dir == Direction::Vertical)
-	{
-		for (int i = 0; i < (int)vertices.size(); i++)
+		else if (dir == Direction::Vertical)
 		{
-			const float t = (vertices[i].position.y - padding_offset.y) / padding_size.y;
-			vertices[i].colour = Math::Lerp(t, colour_start, colour_stop);
+			for (int i = 0; i < (int)vertices.size(); i++)
+			{
+				const float t = (vertices[i].position.y - padding_offset.y) / padding_size.y;
+				vertices[i].colour = Math::Lerp(t, start, stop);
+			}
 		}
-	}
+	}));
 
-	return reinterpret_cast<DecoratorDataHandle>(geometry);
+	return reinterpret_cast<DecoratorDataHandle>(data);
 }
 
 void DecoratorGradient::ReleaseElementData(DecoratorDataHandle element_data) const
 {
-	delete reinterpret_cast<Geometry*>(element_data);
+	delete reinterpret_cast<DecoratorGeometryCache::SharedGeometry*>(element_data);
 }
 
 void DecoratorGradient::RenderElement(Element* element, DecoratorDataHandle element_data) const
 {
-	auto* data = reinterpret_cast<Geometry*>(element_data);
-	data->Render(element->GetAbsoluteOffset(Box::BORDER));
+	auto* data = reinterpret_cast<DecoratorGeometryCache::SharedGeometry*>(element_data);
+	(**data)[0].Render(element->GetAbsoluteOffset(Box::BORDER));
 }
 
 //=======================================================
@@ -27,6 +27,7 @@
  */
 
 #include "DecoratorNinePatch.h"
+#include "DecoratorGeometryCache.h"
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/Geometry.h"
 #include "../../Include/RmlUi/Core/ElementUtilities.h"
@@ -59,18 +60,12 @@ DecoratorDataHandle DecoratorNinePatch::GenerateElementData(Element* element) co
 	RenderInterface* render_interface = element->GetRenderInterface();
 	const auto& computed = element->GetComputedValues();
 
-	Geometry* data = new Geometry(element);
-
 	const Texture* texture = GetTexture();
-	data->SetTexture(texture);
 	const Vector2f texture_dimensions(texture->GetDimensions(render_interface));
 
 	const Vector2f surface_dimensions = element->GetBox().GetSize(Box::PADDING);
 
-	const float opacity = computed.opacity;
-	Colourb quad_colour = computed.image_color;
-
-	quad_colour.alpha = (byte)(opacity * (float)quad_colour.alpha);
+	const Colourb quad_colour = computed.image_color;
 
 
 	/* In the following, we operate on the four diagonal vertices in the grid, as they define the whole grid. */
@@ -124,53 +119,62 @@ DecoratorDataHandle DecoratorNinePatch::GenerateElementData(Element* element) co
 		}
 	}
 
-	/* Now we have all the coordinates we need. Expand the diagonal vertices to the 16 individual vertices. */
+	// Elements with the same surface layout and colour generate identical geometry, share it between them.
+	DecoratorGeometryCache::Key key(this, element);
+	key.Add(surface_dimensions).Add(surface_pos[1]).Add(surface_pos[2]).Add(quad_colour).Add(texture_dimensions);
 
-	Vector<Vertex>& vertices = data->GetVertices();
-	Vector<int>& indices = data->GetIndices();
+	auto data = new DecoratorGeometryCache::SharedGeometry(DecoratorGeometryCache::Acquire(key, 1, [&](GeometryList& geometry_list) {
+		/* Now we have all the coordinates we need. Expand the diagonal vertices to the 16 individual vertices. */
 
-	vertices.resize(4 * 4);
+		Geometry& geometry = geometry_list[0];
+		geometry.SetTexture(texture);
 
-	for (int y = 0; y < 4; y++)
-	{
-		for (int x = 0; x < 4; x++)
+		Vector<Vertex>& vertices = geometry.GetVertices();
+		Vector<int>& indices = geometry.GetIndices();
+
+		vertices.resize(4 * 4);
+
+		for (int y = 0; y < 4; y++)
 		{
-			Vertex& vertex = vertices[y * 4 + x];
-			vertex.colour = quad_colour;
-			vertex.position = { surface_pos[x].x, surface_pos[y].y };
-			vertex.tex_coord = { tex_coords[x].x, tex_coords[y].y };
+			for (int x = 0; x < 4; x++)
+			{
+				Vertex& vertex = vertices[y * 4 + x];
+				vertex.colour = quad_colour;
+				vertex.position = { surface_pos[x].x, surface_pos[y].y };
+				vertex.tex_coord = { tex_coords[x].x, tex_coords[y].y };
+			}
 		}
-	}
 
-	// Nine rectangles, two triangles per rectangle, three indices per triangle.
-	indices.resize(9 * 2 * 3);
+		// Nine rectangles, two triangles per rectangle, three indices per triangle.
+		indices.resize(9 * 2 * 3);
 
-	// Fill in the indices one rectangle at a time.
-	const int top_left_indices[9] = { 0, 1, 2, 4, 5, 6, 8, 9, 10 };
-	for (int rectangle = 0; rectangle < 9; rectangle++)
-	{
-		int i = rectangle * 6;
-		int top_left_index = top_left_indices[rectangle];
-		indices[i]     = top_left_index;
-		indices[i + 1] = top_left_index + 4;
-		indices[i + 2] = top_left_index + 1;
-		indices[i + 3] = top_left_index + 1;
-		indices[i + 4] = top_left_index + 4;
-		indices[i + 5] = top_left_index + 5;
-	}
+		// Fill in the indices one rectangle at a time.
+		const int top_left_indices[9] = { 0, 1, 2, 4, 5, 6, 8, 9, 10 };
+		for (int rectangle = 0; rectangle < 9; rectangle++)
+		{
+			int i = rectangle * 6;
+			int top_left_index = top_left_indices[rectangle];
+			indices[i]     = top_left_index;
+			indices[i + 1] = top_left_index + 4;
+			indices[i + 2] = top_left_index + 1;
+			indices[i + 3] = top_left_index + 1;
+			indices[i + 4] = top_left_index + 4;
+			indices[i + 5] = top_left_index + 5;
+		}
+	}));
 
 	return reinterpret_cast<DecoratorDataHandle>(data);
 }
 
 void DecoratorNinePatch::ReleaseElementData(DecoratorDataHandle element_data) const
 {
-	delete reinterpret_cast< Geometry* >(element_data);
+	delete reinterpret_cast< DecoratorGeometryCache::SharedGeometry* >(element_data);
 }
 
 void DecoratorNinePatch::RenderElement(Element* element, DecoratorDataHandle element_data) const
 {
-	Geometry* data = reinterpret_cast< Geometry* >(element_data);
-	data->Render(element->GetAbsoluteOffset(Box::PADDING).Round());
+	auto* data = reinterpret_cast< DecoratorGeometryCache::SharedGeometry* >(element_data);
+	(**data)[0].Render(element->GetAbsoluteOffset(Box::PADDING).Round());
 }
 
 
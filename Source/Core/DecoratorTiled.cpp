@@ -67,27 +67,23 @@ void DecoratorTiled::Tile::CalculateDimensions(Element* element, const Texture&
 		TileData new_data;
 		const Vector2f texture_dimensions(texture.GetDimensions(render_interface));
 
+		// Leave the tile without data while the texture has no dimensions, such as while it is being loaded
+		// asynchronously, so that they are calculated again when the element data is regenerated.
 		if (texture_dimensions.x == 0 || texture_dimensions.y == 0)
-		{
-			new_data.size = Vector2f(0, 0);
-			new_data.texcoords[0] = Vector2f(0, 0);
-			new_data.texcoords[1] = Vector2f(0, 0);
-		}
+			return;
+
+		// Need to scale the coordinates to normalized units and 'size' to absolute size (pixels)
+		if (size.x == 0 && size.y == 0 && position.x == 0 && position.y == 0)
+			new_data.size = texture_dimensions;
 		else
-		{
-			// Need to scale the coordinates to normalized units and 'size' to absolute size (pixels)
-			if (size.x == 0 && size.y == 0 && position.x == 0 && position.y == 0)
-				new_data.size = texture_dimensions;
-			else
-				new_data.size = size;
-			
-			Vector2f size_relative = new_data.size / texture_dimensions;
-
-			new_data.size = Vector2f(Math::AbsoluteValue(new_data.size.x), Math::AbsoluteValue(new_data.size.y));
-
-			new_data.texcoords[0] = position / texture_dimensions;
-			new_data.texcoords[1] = size_relative + new_data.texcoords[0];
-		}
+			new_data.size = size;
+		
+		Vector2f size_relative = new_data.size / texture_dimensions;
+
+		new_data.size = Vector2f(Math::AbsoluteValue(new_data.size.x), Math::AbsoluteValue(new_data.size.y));
+
+		new_data.texcoords[0] = position / texture_dimensions;
+		new_data.texcoords[1] = size_relative + new_data.texcoords[0];
 
 		data.emplace( render_interface, new_data );
 	}
@@ -113,11 +109,7 @@ void DecoratorTiled::Tile::GenerateGeometry(Vector< Vertex >& vertices, Vector<
 	RenderInterface* render_interface = element->GetRenderInterface();
 	const auto& computed = element->GetComputedValues();
 
-	float opacity = computed.opacity;
-	Colourb quad_colour = computed.image_color;
-
-    // Apply opacity
-    quad_colour.alpha = (byte)(opacity * (float)quad_colour.alpha);
+	const Colourb quad_colour = computed.image_color;
 
 	auto data_iterator = data.find(render_interface);
 	if (data_iterator == data.end())
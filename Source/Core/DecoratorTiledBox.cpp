@@ -27,29 +27,12 @@
  */
 
 #include "DecoratorTiledBox.h"
+#include "DecoratorGeometryCache.h"
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/Geometry.h"
 
 namespace Rml {
 
-struct DecoratorTiledBoxData
-{
-	DecoratorTiledBoxData(Element* host_element, int num_textures) : num_textures(num_textures)
-	{
-		geometry = new Geometry[num_textures];
-		for (int i = 0; i < num_textures; i++)
-			geometry[i].SetHostElement(host_element);
-	}
-
-	~DecoratorTiledBoxData()
-	{
-		delete[] geometry;
-	}
-
-	const int num_textures;
-	Geometry* geometry;
-};
-
 DecoratorTiledBox::DecoratorTiledBox()
 {
 }
@@ -195,86 +178,97 @@ DecoratorDataHandle DecoratorTiledBox::GenerateElementData(Element* element) con
 			bottom_dimensions.y = bottom_right_dimensions.y;
 	}
 
-	const int num_textures = GetNumTextures();
-	DecoratorTiledBoxData* data = new DecoratorTiledBoxData(element, num_textures);
+	// Tiles are left empty while their texture is loading.
+	int num_loaded_tiles = 0;
+	for (int i = 0; i < 9; i++)
+	{
+		if (tiles[i].GetDimensions(element) != Vector2f(0, 0))
+			num_loaded_tiles += 1;
+	}
+
+	// Otherwise the tiles only depend on the padded size and image colour of the element, share the geometry between equal elements.
+	DecoratorGeometryCache::Key key(this, element);
+	key.Add(padded_size).Add(element->GetComputedValues().image_color).Add((float)num_loaded_tiles);
 
-	// Generate the geometry for the top-left tile.
-	tiles[TOP_LEFT_CORNER].GenerateGeometry(data->geometry[tiles[TOP_LEFT_CORNER].texture_index].GetVertices(),
-											data->geometry[tiles[TOP_LEFT_CORNER].texture_index].GetIndices(),
+	auto data = new DecoratorGeometryCache::SharedGeometry(DecoratorGeometryCache::Acquire(key, GetNumTextures(), [&](GeometryList& geometry_list) {
+		// Generate the geometry for the top-left tile.
+		tiles[TOP_LEFT_CORNER].GenerateGeometry(geometry_list[tiles[TOP_LEFT_CORNER].texture_index].GetVertices(),
+												geometry_list[tiles[TOP_LEFT_CORNER].texture_index].GetIndices(),
+												element,
+												Vector2f(0, 0),
+												top_left_dimensions,
+												top_left_dimensions);
+		// Generate the geometry for the top edge tiles.
+		tiles[TOP_EDGE].GenerateGeometry(geometry_list[tiles[TOP_EDGE].texture_index].GetVertices(),
+										 geometry_list[tiles[TOP_EDGE].texture_index].GetIndices(),
+										 element,
+										 Vector2f(top_left_dimensions.x, 0),
+										 Vector2f(padded_size.x - (top_left_dimensions.x + top_right_dimensions.x), top_dimensions.y),
+										 top_dimensions);
+		// Generate the geometry for the top-right tile.
+		tiles[TOP_RIGHT_CORNER].GenerateGeometry(geometry_list[tiles[TOP_RIGHT_CORNER].texture_index].GetVertices(),
+												 geometry_list[tiles[TOP_RIGHT_CORNER].texture_index].GetIndices(),
+												 element,
+												 Vector2f(padded_size.x - top_right_dimensions.x, 0),
+												 top_right_dimensions,
+												 top_right_dimensions);
+
+		// Generate the geometry for the left side.
+		tiles[LEFT_EDGE].GenerateGeometry(geometry_list[tiles[LEFT_EDGE].texture_index].GetVertices(),
+										  geometry_list[tiles[LEFT_EDGE].texture_index].GetIndices(),
+										  element,
+										  Vector2f(0, top_left_dimensions.y),
+										  Vector2f(left_dimensions.x, padded_size.y - (top_left_dimensions.y + bottom_left_dimensions.y)),
+										  left_dimensions);
+
+		// Generate the geometry for the right side.
+		tiles[RIGHT_EDGE].GenerateGeometry(geometry_list[tiles[RIGHT_EDGE].texture_index].GetVertices(),
+										   geometry_list[tiles[RIGHT_EDGE].texture_index].GetIndices(),
+										   element,
+										   Vector2f((padded_size.x - right_dimensions.x), top_right_dimensions.y),
+										   Vector2f(right_dimensions.x, padded_size.y - (top_right_dimensions.y + bottom_right_dimensions.y)),
+										   right_dimensions);
+
+		// Generate the geometry for the bottom-left tile.
+		tiles[BOTTOM_LEFT_CORNER].GenerateGeometry(geometry_list[tiles[BOTTOM_LEFT_CORNER].texture_index].GetVertices(),
+												   geometry_list[tiles[BOTTOM_LEFT_CORNER].texture_index].GetIndices(),
+												   element,
+												   Vector2f(0, padded_size.y - bottom_left_dimensions.y),
+												   bottom_left_dimensions,
+												   bottom_left_dimensions);
+		// Generate the geometry for the bottom edge tiles.
+		tiles[BOTTOM_EDGE].GenerateGeometry(geometry_list[tiles[BOTTOM_EDGE].texture_index].GetVertices(),
+											geometry_list[tiles[BOTTOM_EDGE].texture_index].GetIndices(),
 											element,
-											Vector2f(0, 0),
-											top_left_dimensions,
-											top_left_dimensions);
-	// Generate the geometry for the top edge tiles.
-	tiles[TOP_EDGE].GenerateGeometry(data->geometry[tiles[TOP_EDGE].texture_index].GetVertices(),
-									 data->geometry[tiles[TOP_EDGE].texture_index].GetIndices(),
-									 element,
-									 Vector2f(top_left_dimensions.x, 0),
-									 Vector2f(padded_size.x - (top_left_dimensions.x + top_right_dimensions.x), top_dimensions.y),
-									 top_dimensions);
-	// Generate the geometry for the top-right tile.
-	tiles[TOP_RIGHT_CORNER].GenerateGeometry(data->geometry[tiles[TOP_RIGHT_CORNER].texture_index].GetVertices(),
-											 data->geometry[tiles[TOP_RIGHT_CORNER].texture_index].GetIndices(),
-											 element,
-											 Vector2f(padded_size.x - top_right_dimensions.x, 0),
-											 top_right_dimensions,
-											 top_right_dimensions);
-
-	// Generate the geometry for the left side.
-	tiles[LEFT_EDGE].GenerateGeometry(data->geometry[tiles[LEFT_EDGE].texture_index].GetVertices(),
-									  data->geometry[tiles[LEFT_EDGE].texture_index].GetIndices(),
-									  element,
-									  Vector2f(0, top_left_dimensions.y),
-									  Vector2f(left_dimensions.x, padded_size.y - (top_left_dimensions.y + bottom_left_dimensions.y)),
-									  left_dimensions);
-
-	// Generate the geometry for the right side.
-	tiles[RIGHT_EDGE].GenerateGeometry(data->geometry[tiles[RIGHT_EDGE].texture_index].GetVertices(),
-									   data->geometry[tiles[RIGHT_EDGE].texture_index].GetIndices(),
-									   element,
-									   Vector2f((padded_size.x - right_dimensions.x), top_right_dimensions.y),
-									   Vector2f(right_dimensions.x, padded_size.y - (top_right_dimensions.y + bottom_right_dimensions.y)),
-									   right_dimensions);
-
-	// Generate the geometry for the bottom-left tile.
-	tiles[BOTTOM_LEFT_CORNER].GenerateGeometry(data->geometry[tiles[BOTTOM_LEFT_CORNER].texture_index].GetVertices(),
-											   data->geometry[tiles[BOTTOM_LEFT_CORNER].texture_index].GetIndices(),
-											   element,
-											   Vector2f(0, padded_size.y - bottom_left_dimensions.y),
-											   bottom_left_dimensions,
-											   bottom_left_dimensions);
-	// Generate the geometry for the bottom edge tiles.
-	tiles[BOTTOM_EDGE].GenerateGeometry(data->geometry[tiles[BOTTOM_EDGE].texture_index].GetVertices(),
-										data->geometry[tiles[BOTTOM_EDGE].texture_index].GetIndices(),
+											Vector2f(bottom_left_dimensions.x, padded_size.y - bottom_dimensions.y),
+											Vector2f(padded_size.x - (bottom_left_dimensions.x + bottom_right_dimensions.x), bottom_dimensions.y),
+											bottom_dimensions);
+		// Generate the geometry for the bottom-right tile.
+		tiles[BOTTOM_RIGHT_CORNER].GenerateGeometry(geometry_list[tiles[BOTTOM_RIGHT_CORNER].texture_index].GetVertices(),
+													geometry_list[tiles[BOTTOM_RIGHT_CORNER].texture_index].GetIndices(),
+													element,
+													Vector2f(padded_size.x - bottom_right_dimensions.x, padded_size.y - bottom_right_dimensions.y),
+													bottom_right_dimensions,
+													bottom_right_dimensions);
+
+		// Generate the centre geometry.
+		Vector2f centre_dimensions = tiles[CENTRE].GetDimensions(element);
+		Vector2f centre_surface_dimensions(padded_size.x - (left_dimensions.x + right_dimensions.x),
+												padded_size.y - (top_dimensions.y + bottom_dimensions.y));
+
+		tiles[CENTRE].GenerateGeometry(geometry_list[tiles[CENTRE].texture_index].GetVertices(),
+										geometry_list[tiles[CENTRE].texture_index].GetIndices(),
 										element,
-										Vector2f(bottom_left_dimensions.x, padded_size.y - bottom_dimensions.y),
-										Vector2f(padded_size.x - (bottom_left_dimensions.x + bottom_right_dimensions.x), bottom_dimensions.y),
-										bottom_dimensions);
-	// Generate the geometry for the bottom-right tile.
-	tiles[BOTTOM_RIGHT_CORNER].GenerateGeometry(data->geometry[tiles[BOTTOM_RIGHT_CORNER].texture_index].GetVertices(),
-												data->geometry[tiles[BOTTOM_RIGHT_CORNER].texture_index].GetIndices(),
-												element,
-												Vector2f(padded_size.x - bottom_right_dimensions.x, padded_size.y - bottom_right_dimensions.y),
-												bottom_right_dimensions,
-												bottom_right_dimensions);
-
-	// Generate the centre geometry.
-	Vector2f centre_dimensions = tiles[CENTRE].GetDimensions(element);
-	Vector2f centre_surface_dimensions(padded_size.x - (left_dimensions.x + right_dimensions.x),
-											padded_size.y - (top_dimensions.y + bottom_dimensions.y));
-
-	tiles[CENTRE].GenerateGeometry(data->geometry[tiles[CENTRE].texture_index].GetVertices(),
-									data->geometry[tiles[CENTRE].texture_index].GetIndices(),
-									element,
-									Vector2f(left_dimensions.x, top_dimensions.y),
-									centre_surface_dimensions,
-									centre_dimensions);
-
-	// Set the textures on the geometry.
-	const Texture* texture = nullptr;
-	int texture_index = 0;
-	while ((texture = GetTexture(texture_index)) != nullptr)
-		data->geometry[texture_index++].SetTexture(texture);
+										Vector2f(left_dimensions.x, top_dimensions.y),
+										centre_surface_dimensions,
+										centre_dimensions);
+
+		// Set the textures on the geometry.
+		const Texture* texture = nullptr;
+		int texture_index = 0;
+		while ((texture = GetTexture(texture_index)) != nullptr)
+			geometry_list[texture_index++].SetTexture(texture);
+	}));
 
 	return reinterpret_cast<DecoratorDataHandle>(data);
 }
@@ -282,17 +276,17 @@ DecoratorDataHandle DecoratorTiledBox::GenerateElementData(Element* element) con
 // Called to release element data generated by this decorator.
 void DecoratorTiledBox::ReleaseElementData(DecoratorDataHandle element_data) const
 {
-	delete reinterpret_cast< DecoratorTiledBoxData* >(element_data);
+	delete reinterpret_cast< DecoratorGeometryCache::SharedGeometry* >(element_data);
 }
 
 // Called to render the decorator on an element.
 void DecoratorTiledBox::RenderElement(Element* element, DecoratorDataHandle element_data) const
 {
 	Vector2f translation = element->GetAbsoluteOffset(Box::PADDING).Round();
-	DecoratorTiledBoxData* data = reinterpret_cast< DecoratorTiledBoxData* >(element_data);
+	auto* data = reinterpret_cast< DecoratorGeometryCache::SharedGeometry* >(element_data);
 
-	for (int i = 0; i < data->num_textures; i++)
-		data->geometry[i].Render(translation);
+	for (Geometry& geometry : **data)
+		geometry.Render(translation);
 }
 
 } // namespace Rml
@@ -40,22 +40,30 @@
 #include "../../Include/RmlUi/Core/PropertyIdSet.h"
 #include "../../Include/RmlUi/Core/PropertiesIteratorView.h"
 #include "../../Include/RmlUi/Core/PropertyDefinition.h"
+#include "../../Include/RmlUi/Core/RenderInterface.h"
 #include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
 #include "../../Include/RmlUi/Core/TransformPrimitive.h"
+#include "AnimationTimeline.h"
 #include "Clock.h"
+#include "CompiledSelector.h"
 #include "ComputeProperty.h"
 #include "DataModel.h"
 #include "ElementAnimation.h"
 #include "ElementBackgroundBorder.h"
 #include "ElementDefinition.h"
+#include "ElementIndex.h"
+#include "ElementRenderCache.h"
 #include "ElementStyle.h"
 #include "EventDispatcher.h"
 #include "EventSpecification.h"
+#include "FrameStatisticsScope.h"
 #include "ElementDecoration.h"
+#include "HitTestGrid.h"
 #include "LayoutEngine.h"
 #include "PluginRegistry.h"
 #include "PropertiesIterator.h"
 #include "Pool.h"
+#include "StyleSheetFactory.h"
 #include "StyleSheetParser.h"
 #include "StyleSheetNode.h"
 #include "TransformState.h"
@@ -87,7 +95,7 @@ static Pool< ElementMeta > element_meta_chunk_pool(200, true);
 
 /// Constructs a new RmlUi element.
 Element::Element(const String& tag) : tag(tag), relative_offset_base(0, 0), relative_offset_position(0, 0), absolute_offset(0, 0), scroll_offset(0, 0), content_offset(0, 0), content_box(0, 0), 
-transform_state(), dirty_transform(false), dirty_perspective(false), dirty_animation(false), dirty_transition(false)
+transform_state(), dirty_transform(false), dirty_perspective(false), dirty_animation(false), dirty_transition(false), in_animation_timeline(false)
 {
 	RMLUI_ASSERT(tag == StringUtilities::ToLower(tag));
 	parent = nullptr;
@@ -115,6 +123,10 @@ transform_state(), dirty_transform(false), dirty_perspective(false), dirty_anima
 
 	structure_dirty = false;
 
+	update_dirty = true;
+	update_every_frame = true;
+	render_within_border_box = false;
+
 	computed_values_are_default_initialized = true;
 
 	meta = element_meta_chunk_pool.AllocateAndConstruct(this);
@@ -145,19 +157,35 @@ Element::~Element()
 
 void Element::Update(float dp_ratio, Vector2f vp_dimensions)
 {
+	// Nothing has changed in this subtree since the last update, we can skip it entirely.
+	if (!update_dirty)
+		return;
+
 #ifdef RMLUI_ENABLE_PROFILING
 	auto name = GetAddress(false, false);
 	RMLUI_ZoneScoped;
 	RMLUI_ZoneText(name.c_str(), name.size());
 #endif
 
+	// Anything dirtied from here on will set the flag again, and be picked up no later than the next update.
+	update_dirty = false;
+
+	FrameStatisticsScope::Add(&FrameStatistics::num_elements_updated);
+
+	// We can't tell what changes are made in the update of arbitrary element types.
+	if (update_every_frame)
+		DirtyRenderCache();
+
 	OnUpdate();
 
 	UpdateStructure();
 
+	// Running animations are advanced by the context's animation timeline, here we only need to advance newly started animations.
+	const bool animations_started = (dirty_animation || !in_animation_timeline);
 	HandleTransitionProperty();
 	HandleAnimationProperty();
-	AdvanceAnimations();
+	if (animations_started)
+		AdvanceAnimations();
 
 	meta->scroll.Update();
 
@@ -173,6 +201,13 @@ void Element::Update(float dp_ratio, Vector2f vp_dimensions)
 
 	for (size_t i = 0; i < children.size(); i++)
 		children[i]->Update(dp_ratio, vp_dimensions);
+
+	// Some state needs to be updated every frame, and any dirty children must be reachable on the next update.
+	if (update_every_frame || meta->scroll.HasScrollbars())
+		update_dirty = true;
+
+	for (size_t i = 0; i < children.size() && !update_dirty; i++)
+		update_dirty = children[i]->update_dirty;
 }
 
 void Element::UpdateProperties(const float dp_ratio, const Vector2f vp_dimensions)
@@ -215,6 +250,15 @@ void Element::Render()
 
 	UpdateTransformState();
 
+	// Skip rendering when we are not visible, along with our stacking context if it can't be visible either.
+	const bool culled = IsRenderCulled();
+	if (culled && IsStackingContextCulledWithUs())
+		return;
+
+	// Render from our cached texture if possible, unless we are currently rendering into it.
+	if (render_cache && !render_cache->IsRendering() && render_cache->Render(this))
+		return;
+
 	// Render all elements in our local stacking context that have a z-index beneath our local index of 0.
 	size_t i = 0;
 	for (; i < stacking_context.size() && stacking_context[i]->z_index < 0; ++i)
@@ -223,8 +267,12 @@ void Element::Render()
 	// Apply our transform
 	ElementUtilities::ApplyTransform(*this);
 
+	// Apply our opacity, the geometry below is generated without it.
+	if (RenderInterface* render_interface = GetRenderInterface())
+		render_interface->ApplyOpacity(meta->computed_values.opacity);
+
 	// Set up the clipping region for this element.
-	if (ElementUtilities::SetClippingRegion(this))
+	if (!culled && ElementUtilities::SetClippingRegion(this))
 	{
 		meta->background_border.Render(this);
 		meta->decoration.RenderDecorators();
@@ -454,6 +502,7 @@ void Element::SetBox(const Box& box)
 		additional_boxes.clear();
 
 		OnResize();
+		DirtyHitTest();
 
 		meta->background_border.DirtyBackground();
 		meta->background_border.DirtyBorder();
@@ -467,6 +516,7 @@ void Element::AddBox(const Box& box, Vector2f offset)
 	additional_boxes.emplace_back(PositionedBox{ box, offset });
 
 	OnResize();
+	DirtyHitTest();
 
 	meta->background_border.DirtyBackground();
 	meta->background_border.DirtyBorder();
@@ -1024,10 +1074,9 @@ Element* Element::GetParentNode() const
 // Recursively search for a ancestor of this node matching the given selector.
 Element* Element::Closest(const String& selectors) const
 {
-	StyleSheetNode root_node;
-	StyleSheetNodeListRaw leaf_nodes = StyleSheetParser::ConstructNodes(root_node, selectors);
+	SharedPtr<const CompiledSelector> selector = StyleSheetFactory::GetCompiledSelector(selectors);
 
-	if (leaf_nodes.empty())
+	if (!selector->IsValid())
 	{
 		Log::Message(Log::LT_WARNING, "Query selector '%s' is empty. In element %s", selectors.c_str(), GetAddress().c_str());
 		return nullptr;
@@ -1037,13 +1086,8 @@ Element* Element::Closest(const String& selectors) const
 
 	while(parent)
 	{
-		for (const StyleSheetNode* node : leaf_nodes)
-		{
-			if (node->IsApplicable(parent, false))
-			{
-				return parent;
-			}
-		}
+		if (selector->Matches(parent))
+			return parent;
 		
 		parent = parent->GetParentNode();
 	}
@@ -1493,75 +1537,30 @@ void Element::GetElementsByClassName(ElementList& elements, const String& class_
 	return ElementUtilities::GetElementsByClassName(elements, this, class_name);
 }
 
-static Element* QuerySelectorMatchRecursive(const StyleSheetNodeListRaw& nodes, Element* element)
-{
-	const int num_children = element->GetNumChildren();
-
-	for (int i = 0; i < num_children; i++)
-	{
-		Element* child = element->GetChild(i);
-
-		for (const StyleSheetNode* node : nodes)
-		{
-			if (node->IsApplicable(child, false))
-				return child;
-		}
-
-		Element* matching_element = QuerySelectorMatchRecursive(nodes, child);
-		if (matching_element)
-			return matching_element;
-	}
-
-	return nullptr;
-}
-
-static void QuerySelectorAllMatchRecursive(ElementList& matching_elements, const StyleSheetNodeListRaw& nodes, Element* element)
-{
-	const int num_children = element->GetNumChildren();
-
-	for (int i = 0; i < num_children; i++)
-	{
-		Element* child = element->GetChild(i);
-
-		for (const StyleSheetNode* node : nodes)
-		{
-			if (node->IsApplicable(child, false))
-			{
-				matching_elements.push_back(child);
-				break;
-			}
-		}
-
-		QuerySelectorAllMatchRecursive(matching_elements, nodes, child);
-	}
-}
-
 Element* Element::QuerySelector(const String& selectors)
 {
-	StyleSheetNode root_node;
-	StyleSheetNodeListRaw leaf_nodes = StyleSheetParser::ConstructNodes(root_node, selectors);
+	SharedPtr<const CompiledSelector> selector = StyleSheetFactory::GetCompiledSelector(selectors);
 
-	if (leaf_nodes.empty())
+	if (!selector->IsValid())
 	{
 		Log::Message(Log::LT_WARNING, "Query selector '%s' is empty. In element %s", selectors.c_str(), GetAddress().c_str());
 		return nullptr;
 	}
 
-	return QuerySelectorMatchRecursive(leaf_nodes, this);
+	return selector->QueryFirst(this);
 }
 
 void Element::QuerySelectorAll(ElementList& elements, const String& selectors)
 {
-	StyleSheetNode root_node;
-	StyleSheetNodeListRaw leaf_nodes = StyleSheetParser::ConstructNodes(root_node, selectors);
+	SharedPtr<const CompiledSelector> selector = StyleSheetFactory::GetCompiledSelector(selectors);
 
-	if (leaf_nodes.empty())
+	if (!selector->IsValid())
 	{
 		Log::Message(Log::LT_WARNING, "Query selector '%s' is empty. In element %s", selectors.c_str(), GetAddress().c_str());
 		return;
 	}
 
-	QuerySelectorAllMatchRecursive(elements, leaf_nodes, this);
+	selector->QueryAll(elements, this);
 }
 
 // Access the event dispatcher
@@ -1656,8 +1655,15 @@ void Element::OnAttributeChange(const ElementAttributes& changed_attributes)
 	auto it = changed_attributes.find("id");
 	if (it != changed_attributes.end())
 	{
+		ElementIndex* index = ElementIndex::GetFor(this);
+		if (index)
+			index->EraseId(this, id);
+
 		id = it->second.Get<String>();
 		meta->style.DirtyDefinition();
+
+		if (index)
+			index->InsertId(this, id);
 	}
 
 	it = changed_attributes.find("class");
@@ -1678,6 +1684,35 @@ void Element::OnAttributeChange(const ElementAttributes& changed_attributes)
 			DirtyLayout();
 	}
 
+	if (changed_attributes.count("render-cache"))
+	{
+		const bool enable_cache = HasAttribute("render-cache");
+		if (enable_cache && !render_cache)
+		{
+			// The cache renders our stacking context, so that all our descendants are included.
+			render_cache = MakeUnique<ElementRenderCache>();
+			if (!local_stacking_context)
+			{
+				local_stacking_context = true;
+				stacking_context_dirty = true;
+				if (parent)
+					parent->DirtyStackingContext();
+			}
+		}
+		else if (!enable_cache && render_cache)
+		{
+			render_cache.reset();
+			if (local_stacking_context && !local_stacking_context_forced && meta->computed_values.z_index.type == Style::ZIndex::Auto)
+			{
+				local_stacking_context = false;
+				stacking_context_dirty = false;
+				stacking_context.clear();
+				if (parent)
+					parent->DirtyStackingContext();
+			}
+		}
+	}
+
 	it = changed_attributes.find("style");
 	if (it != changed_attributes.end())
 	{
@@ -1704,6 +1739,8 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 {
 	RMLUI_ZoneScoped;
 
+	DirtyRenderCache();
+
 	if (!IsLayoutDirty())
 	{
 		// Force a relayout if any of the changed properties require it.
@@ -1767,7 +1804,8 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 		if (z_index_property.type == Style::ZIndex::Auto)
 		{
 			if (local_stacking_context &&
-				!local_stacking_context_forced)
+				!local_stacking_context_forced &&
+				!render_cache)
 			{
 				// We're no longer acting as a stacking context.
 				local_stacking_context = false;
@@ -1806,7 +1844,6 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 	// Dirty the background if it's changed.
     if (border_radius_changed ||
 		changed_properties.Contains(PropertyId::BackgroundColor) ||
-		changed_properties.Contains(PropertyId::Opacity) ||
 		changed_properties.Contains(PropertyId::ImageColor))
 	{
 		meta->background_border.DirtyBackground();
@@ -1821,8 +1858,7 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 		changed_properties.Contains(PropertyId::BorderTopColor) ||
 		changed_properties.Contains(PropertyId::BorderRightColor) ||
 		changed_properties.Contains(PropertyId::BorderBottomColor) ||
-		changed_properties.Contains(PropertyId::BorderLeftColor) ||
-		changed_properties.Contains(PropertyId::Opacity))
+		changed_properties.Contains(PropertyId::BorderLeftColor))
 	{
 		meta->background_border.DirtyBorder();
 	}
@@ -1830,7 +1866,6 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 	// Dirty the decoration if it's changed.
 	if (border_radius_changed ||
 		changed_properties.Contains(PropertyId::Decorator) ||
-		changed_properties.Contains(PropertyId::Opacity) ||
 		changed_properties.Contains(PropertyId::ImageColor))
 	{
 		meta->decoration.DirtyDecorators();
@@ -1857,11 +1892,13 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 	if (changed_properties.Contains(PropertyId::Animation))
 	{
 		dirty_animation = true;
+		DirtyUpdate();
 	}
 	// Check for `transition' changes
 	if (changed_properties.Contains(PropertyId::Transition))
 	{
 		dirty_transition = true;
+		DirtyUpdate();
 	}
 }
 
@@ -1879,9 +1916,18 @@ void Element::OnChildRemove(Element* /*child*/)
 {
 }
 
+void Element::OnTexturesLoaded()
+{
+	// Decorators may have been generated without the dimensions of their textures.
+	if (meta->computed_values.decorator)
+		meta->decoration.DirtyDecorators();
+}
+
 // Forces a re-layout of this element, and any other children required.
 void Element::DirtyLayout()
 {
+	DirtyRenderCache();
+
 	Element* document = GetOwnerDocument();
 	if (document != nullptr)
 		document->DirtyLayout();
@@ -2008,7 +2054,14 @@ void Element::SetOwnerDocument(ElementDocument* document)
 	// If this element is a document, then never change owner_document.
 	if (owner_document != this && owner_document != document)
 	{
+		if (ElementIndex* index = ElementIndex::GetFor(this))
+			index->Erase(this);
+
 		owner_document = document;
+
+		if (ElementIndex* index = ElementIndex::GetFor(this))
+			index->Insert(this);
+
 		for (ElementPtr& child : children)
 			child->SetOwnerDocument(document);
 	}
@@ -2097,6 +2150,7 @@ void Element::DirtyOffset()
 	if(!offset_dirty)
 	{
 		offset_dirty = true;
+		DirtyHitTest();
 
 		if(transform_state)
 			DirtyTransformState(true, true);
@@ -2181,6 +2235,9 @@ void Element::BuildLocalStackingContext()
 	stacking_context_dirty = false;
 	stacking_context.clear();
 
+	if (hit_test_grid)
+		hit_test_grid->SetDirty();
+
 	BuildStackingContext(&stacking_context);
 	std::stable_sort(stacking_context.begin(), stacking_context.end(), [](const Element* lhs, const Element* rhs) { return lhs->GetZIndex() < rhs->GetZIndex(); });
 }
@@ -2312,11 +2369,35 @@ void Element::DirtyStackingContext()
 
 	if (stacking_context_parent)
 		stacking_context_parent->stacking_context_dirty = true;
+
+	DirtyRenderCache();
 }
 
 void Element::DirtyStructure()
 {
 	structure_dirty = true;
+	DirtyUpdate();
+}
+
+void Element::DirtyAnimationTracks()
+{
+	// Make sure the element is visited during the next update, so that new animations are started.
+	DirtyUpdate();
+
+	if (in_animation_timeline)
+	{
+		if (Context* context = GetContext())
+			context->animation_timeline->DirtyTracks();
+	}
+}
+
+void Element::DirtyUpdate()
+{
+	update_dirty = true;
+
+	// Ancestors of an element needing update are already marked, unless they are currently being updated.
+	for (Element* ancestor = parent; ancestor && !ancestor->update_dirty; ancestor = ancestor->parent)
+		ancestor->update_dirty = true;
 }
 
 void Element::UpdateStructure()
@@ -2341,7 +2422,10 @@ bool Element::Animate(const String & property_name, const Property & target_valu
 	{
 		result = it_animation->AddKey(duration, target_value, *this, tween, true);
 		if (!result)
+		{
 			animations.erase(it_animation);
+			DirtyAnimationTracks();
+		}
 	}
 
 	return result;
@@ -2381,6 +2465,7 @@ ElementAnimationList::iterator Element::StartAnimation(PropertyId property_id, c
 	{
 		animations.emplace_back();
 		it = animations.end() - 1;
+		DirtyAnimationTracks();
 	}
 
 	Property value;
@@ -2408,6 +2493,7 @@ ElementAnimationList::iterator Element::StartAnimation(PropertyId property_id, c
 	{
 		animations.erase(it);
 		it = animations.end();
+		DirtyAnimationTracks();
 	}
 
 	return it;
@@ -2454,6 +2540,7 @@ bool Element::StartTransition(const Transition & transition, const Property& sta
 			ElementAnimation{ transition.id, ElementAnimationOrigin::Transition, start_value, *this, start_time, 0.0f, 1, false }
 		);
 		it = (animations.end() - 1);
+		DirtyAnimationTracks();
 	}
 	else
 	{
@@ -2468,9 +2555,14 @@ bool Element::StartTransition(const Transition & transition, const Property& sta
 	bool result = it->AddKey(duration, target_value, *this, transition.tween, true);
 
 	if (result)
+	{
 		SetProperty(transition.id, start_value);
+	}
 	else
+	{
 		animations.erase(it);
+		DirtyAnimationTracks();
+	}
 
 	return result;
 }
@@ -2520,6 +2612,7 @@ void Element::HandleTransitionProperty()
 			RemoveProperty(it->GetPropertyId());
 
 		animations.erase(it_remove, animations.end());
+		DirtyAnimationTracks();
 	}
 }
 
@@ -2552,6 +2645,7 @@ void Element::HandleAnimationProperty()
 					RemoveProperty(it->GetPropertyId());
 
 				animations.erase(it_remove, animations.end());
+				DirtyAnimationTracks();
 			}
 
 			// Start animations
@@ -2599,37 +2693,94 @@ void Element::AdvanceAnimations()
 		{
 			Property property = animation.UpdateAndGetProperty(time, *this);
 			if (property.unit != Property::UNKNOWN)
-				SetProperty(animation.GetPropertyId(), property);
+				SetAnimationProperty(animation.GetPropertyId(), property);
 		}
 
-		// Move all completed animations to the end of the list
-		auto it_completed = std::partition(animations.begin(), animations.end(), [](const ElementAnimation& animation) { return !animation.IsComplete(); });
-
-		Vector<Dictionary> dictionary_list;
-		Vector<bool> is_transition;
-		dictionary_list.reserve(animations.end() - it_completed);
-		is_transition.reserve(animations.end() - it_completed);
+		HandleCompletedAnimations();
 
-		for (auto it = it_completed; it != animations.end(); ++it)
+		// From now on the animations are advanced by the context.
+		if (!in_animation_timeline && !animations.empty())
 		{
-			const String& property_name = StyleSheetSpecification::GetPropertyName(it->GetPropertyId());
+			if (Context* context = GetContext())
+				context->animation_timeline->AddElement(this);
+		}
+	}
+}
+
+void Element::SetAnimationProperty(PropertyId id, const Property& property)
+{
+	bool value_changed = false;
+	if (!meta->style.SetPropertyDirect(id, property, meta->computed_values, value_changed))
+	{
+		SetProperty(id, property);
+		return;
+	}
+
+	if (!value_changed)
+		return;
+
+	// Derived elements may react to any property change, so they are notified even though the style is bypassed. For
+	// the transform, this only dirties the transform state used for rendering and hit testing.
+	PropertyIdSet changed_properties;
+	changed_properties.Insert(id);
+	OnPropertyChange(changed_properties);
 
-			dictionary_list.emplace_back();
-			dictionary_list.back().emplace("property", Variant(property_name));
-			is_transition.push_back(it->IsTransition());
+	if (id == PropertyId::Opacity)
+		InheritAnimationOpacity(changed_properties);
+}
 
-			// Remove completed transition- and animation-initiated properties.
-			// Should behave like in HandleTransitionProperty() and HandleAnimationProperty() respectively.
-			if (it->GetOrigin() != ElementAnimationOrigin::User)
-				RemoveProperty(it->GetPropertyId());
+void Element::InheritAnimationOpacity(const PropertyIdSet& changed_properties)
+{
+	const float opacity = meta->computed_values.opacity;
+
+	for (const ElementPtr& child : children)
+	{
+		// Children with their own opacity don't inherit ours.
+		if (child->meta->style.GetLocalProperty(PropertyId::Opacity))
+			continue;
+
+		Style::ComputedValues& child_values = child->meta->computed_values;
+		if (child_values.opacity != opacity)
+		{
+			child_values.opacity = opacity;
+			child->OnPropertyChange(changed_properties);
+			child->InheritAnimationOpacity(changed_properties);
 		}
+	}
+}
+
+void Element::HandleCompletedAnimations()
+{
+	// Move all completed animations to the end of the list
+	auto it_completed = std::partition(animations.begin(), animations.end(), [](const ElementAnimation& animation) { return !animation.IsComplete(); });
+	if (it_completed == animations.end())
+		return;
 
-		// Need to erase elements before submitting event, as iterators might be invalidated when calling external code.
-		animations.erase(it_completed, animations.end());
+	Vector<Dictionary> dictionary_list;
+	Vector<bool> is_transition;
+	dictionary_list.reserve(animations.end() - it_completed);
+	is_transition.reserve(animations.end() - it_completed);
 
-		for (size_t i = 0; i < dictionary_list.size(); i++)
-			DispatchEvent(is_transition[i] ? EventId::Transitionend : EventId::Animationend, dictionary_list[i]);
+	for (auto it = it_completed; it != animations.end(); ++it)
+	{
+		const String& property_name = StyleSheetSpecification::GetPropertyName(it->GetPropertyId());
+
+		dictionary_list.emplace_back();
+		dictionary_list.back().emplace("property", Variant(property_name));
+		is_transition.push_back(it->IsTransition());
+
+		// Remove completed transition- and animation-initiated properties.
+		// Should behave like in HandleTransitionProperty() and HandleAnimationProperty() respectively.
+		if (it->GetOrigin() != ElementAnimationOrigin::User)
+			RemoveProperty(it->GetPropertyId());
 	}
+
+	// Need to erase elements before submitting event, as iterators might be invalidated when calling external code.
+	animations.erase(it_completed, animations.end());
+	DirtyAnimationTracks();
+
+	for (size_t i = 0; i < dictionary_list.size(); i++)
+		DispatchEvent(is_transition[i] ? EventId::Transitionend : EventId::Animationend, dictionary_list[i]);
 }
 
 
@@ -2638,8 +2789,116 @@ void Element::DirtyTransformState(bool perspective_dirty, bool transform_dirty)
 {
 	dirty_perspective |= perspective_dirty;
 	dirty_transform |= transform_dirty;
+	DirtyHitTest();
+}
+
+void Element::DirtyHitTest()
+{
+	// Only the stacking context we are part of may hold our entry in its hit test grid.
+	for (Element* ancestor = parent; ancestor; ancestor = ancestor->parent)
+	{
+		if (ancestor->local_stacking_context)
+		{
+			if (ancestor->hit_test_grid)
+				ancestor->hit_test_grid->DirtyElement(this);
+			break;
+		}
+	}
+
+	DirtyRenderCache();
+}
+
+void Element::DirtyRenderCache()
+{
+	// Elements outside any context may be carrying caches, and are always searched.
+	Context* context = GetContext();
+	if (context && !ElementRenderCache::AnyCachesExist(context))
+		return;
+
+	for (Element* element = this; element; element = element->parent)
+	{
+		if (element->render_cache)
+			element->render_cache->SetDirty();
+	}
 }
 
+ElementBackgroundBorder& Element::GetBackgroundBorder()
+{
+	return meta->background_border;
+}
+
+void Element::NotifyTexturesLoaded()
+{
+	OnTexturesLoaded();
+	DirtyRenderCache();
+}
+
+
+bool Element::IsRenderCulled()
+{
+	if (!render_within_border_box)
+		return false;
+
+	// Transforms may move our boxes anywhere, don't try to bound them.
+	if (transform_state && transform_state->GetTransform())
+		return false;
+
+	Context* context = GetContext();
+	if (!context)
+		return false;
+
+	Vector2i clip_origin, clip_dimensions;
+	if (!ElementUtilities::GetClippingRegion(clip_origin, clip_dimensions, this))
+	{
+		clip_origin = Vector2i(0, 0);
+		clip_dimensions = context->GetDimensions();
+	}
+
+	const Vector2f clip_min = Vector2f(clip_origin);
+	const Vector2f clip_max = Vector2f(clip_origin + clip_dimensions);
+	const Vector2f border_offset = GetAbsoluteOffset(Box::BORDER);
+
+	const int num_boxes = GetNumBoxes();
+	for (int i = 0; i < num_boxes; i++)
+	{
+		Vector2f box_offset;
+		const Box& box = GetBox(i, box_offset);
+		const Vector2f box_min = border_offset + box_offset;
+		const Vector2f box_max = box_min + box.GetSize(Box::BORDER);
+
+		if (box_max.x > clip_min.x && box_min.x < clip_max.x && box_max.y > clip_min.y && box_min.y < clip_max.y)
+			return false;
+	}
+
+	return true;
+}
+
+bool Element::IsStackingContextCulledWithUs()
+{
+	if (stacking_context.empty())
+		return true;
+
+	// Our descendants are only clipped to our client area when we actually clip any overflow, see ElementUtilities::GetClippingRegion().
+	const bool clips_overflow = IsClippingEnabled() &&
+		(GetClientWidth() < GetScrollWidth() - 0.5f || GetClientHeight() < GetScrollHeight() - 0.5f);
+
+	return clips_overflow && !CanStackingContextEscapeClipping();
+}
+
+bool Element::CanStackingContextEscapeClipping()
+{
+	// A stale stacking context may refer to removed elements, assume the worst.
+	if (stacking_context_dirty)
+		return true;
+
+	for (Element* element : stacking_context)
+	{
+		if (element->GetClippingIgnoreDepth() != 0 || element->CanStackingContextEscapeClipping())
+			return true;
+	}
+
+	return false;
+}
 
 void Element::UpdateTransformState()
 {
@@ -27,27 +27,24 @@
  */
 
 #include "ElementBackgroundBorder.h"
+#include "FrameStatisticsScope.h"
+#include "GeometryBackgroundBorder.h"
 #include "../../Include/RmlUi/Core/Box.h"
 #include "../../Include/RmlUi/Core/ComputedValues.h"
+#include "../../Include/RmlUi/Core/Context.h"
 #include "../../Include/RmlUi/Core/Element.h"
-#include "../../Include/RmlUi/Core/GeometryUtilities.h"
 
 namespace Rml {
 
 
-ElementBackgroundBorder::ElementBackgroundBorder(Element* element) : geometry(element)
+ElementBackgroundBorder::ElementBackgroundBorder(Element* element) : element(element), geometry(element)
 {}
 
 void ElementBackgroundBorder::Render(Element * element)
 {
 	if (background_dirty || border_dirty)
-	{
 		GenerateGeometry(element);
 
-		background_dirty = false;
-		border_dirty = false;
-	}
-
 	if (geometry)
 		geometry.Render(element->GetAbsoluteOffset(Box::BORDER));
 }
@@ -55,53 +52,81 @@ void ElementBackgroundBorder::Render(Element * element)
 void ElementBackgroundBorder::DirtyBackground()
 {
 	background_dirty = true;
+	QueuePrepare();
 }
 
 void ElementBackgroundBorder::DirtyBorder()
 {
 	border_dirty = true;
+	QueuePrepare();
 }
 
-void ElementBackgroundBorder::GenerateGeometry(Element* element)
+void ElementBackgroundBorder::QueuePrepare()
+{
+	if (prepare_queued)
+		return;
+
+	if (Context* context = element->GetContext())
+	{
+		context->DirtyBackgroundBorder(element);
+		prepare_queued = (context->geometry_workers != nullptr);
+	}
+}
+
+bool ElementBackgroundBorder::IsDirty() const
+{
+	return background_dirty || border_dirty;
+}
+
+void ElementBackgroundBorder::GenerateGeometry(Element* element, Vector<Vertex>& vertices, Vector<int>& indices)
 {
 	const ComputedValues& computed = element->GetComputedValues();
 
-	Colourb background_color = computed.background_color;
-	Colourb border_colors[4] = {
+	const Colourb background_color = computed.background_color;
+	const Colourb border_colors[4] = {
 		computed.border_top_color,
 		computed.border_right_color,
 		computed.border_bottom_color,
 		computed.border_left_color,
 	};
-	
-	// Apply opacity
-	const float opacity = computed.opacity;
-	background_color.alpha = (byte)(opacity * (float)background_color.alpha);
 
-	if (opacity < 1)
-	{
-		for (int i = 0; i < 4; ++i)
-			border_colors[i].alpha = (byte)(opacity * (float)border_colors[i].alpha);
-	}
+	vertices.clear();
+	indices.clear();
 
-	geometry.GetVertices().clear();
-	geometry.GetIndices().clear();
-
-	const Vector4f radii(
+	const CornerSizes radii{
 		computed.border_top_left_radius,
 		computed.border_top_right_radius,
 		computed.border_bottom_right_radius,
 		computed.border_bottom_left_radius
-	);
+	};
 
 	for (int i = 0; i < element->GetNumBoxes(); i++)
 	{
 		Vector2f offset;
 		const Box& box = element->GetBox(i, offset);
-		GeometryUtilities::GenerateBackgroundBorder(&geometry, box, offset, radii, background_color, border_colors);
+		GeometryBackgroundBorder::Draw(vertices, indices, radii, box, offset, background_color, border_colors);
 	}
+}
+
+void ElementBackgroundBorder::SetGeometry(Vector<Vertex>&& vertices, Vector<int>&& indices)
+{
+	FrameStatisticsScope::Add(&FrameStatistics::num_geometry_generated);
 
+	geometry.GetVertices() = std::move(vertices);
+	geometry.GetIndices() = std::move(indices);
 	geometry.Release();
+
+	background_dirty = false;
+	border_dirty = false;
+}
+
+void ElementBackgroundBorder::GenerateGeometry(Element* element)
+{
+	Vector<Vertex> vertices = std::move(geometry.GetVertices());
+	Vector<int> indices = std::move(geometry.GetIndices());
+
+	GenerateGeometry(element, vertices, indices);
+	SetGeometry(std::move(vertices), std::move(indices));
 }
 
 } // namespace Rml
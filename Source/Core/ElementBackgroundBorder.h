@@ -34,6 +34,8 @@
 
 namespace Rml {
 
+class Context;
+
 class ElementBackgroundBorder {
 public:
 	ElementBackgroundBorder(Element* element);
@@ -43,13 +45,30 @@ public:
 	void DirtyBackground();
 	void DirtyBorder();
 
+	// Returns true if the geometry must be regenerated before it is rendered.
+	bool IsDirty() const;
+
+	// Generates the background and border of the element into the given buffers. Only reads from the element, thus it
+	// can be called from worker threads as long as the element is not modified meanwhile.
+	static void GenerateGeometry(Element* element, Vector<Vertex>& vertices, Vector<int>& indices);
+	// Replaces the geometry with previously generated buffers, and clears the dirty state.
+	void SetGeometry(Vector<Vertex>&& vertices, Vector<int>&& indices);
+
 private:
 	void GenerateGeometry(Element* element);
+	// Queues the geometry to be regenerated by the context's geometry workers, if not already queued.
+	void QueuePrepare();
+
+	Element* element;
 
 	bool background_dirty = false;
 	bool border_dirty = false;
+	// True while queued in the context for the prepare phase.
+	bool prepare_queued = false;
 
 	Geometry geometry;
+
+	friend class Rml::Context;
 };
 
 } // namespace Rml
@@ -28,6 +28,8 @@
 
 #include "ElementDecoration.h"
 #include "ElementDefinition.h"
+#include "FrameStatisticsScope.h"
+#include "TextureDatabase.h"
 #include "../../Include/RmlUi/Core/Decorator.h"
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
@@ -38,6 +40,7 @@ ElementDecoration::ElementDecoration(Element* _element)
 {
 	element = _element;
 	decorators_dirty = false;
+	decorators_translucent = false;
 }
 
 ElementDecoration::~ElementDecoration()
@@ -51,6 +54,8 @@ bool ElementDecoration::ReloadDecorators()
 	RMLUI_ZoneScopedC(0xB22222);
 	ReleaseDecorators();
 
+	decorators_translucent = (element->GetComputedValues().opacity < 1.f);
+
 	auto& decorators_ptr = element->GetComputedValues().decorator;
 	if (!decorators_ptr)
 		return true;
@@ -71,6 +76,11 @@ int ElementDecoration::LoadDecorator(SharedPtr<const Decorator> decorator)
 {
 	DecoratorHandle element_decorator;
 	element_decorator.decorator_data = decorator->GenerateElementData(element);
+	FrameStatisticsScope::Add(&FrameStatistics::num_geometry_generated);
+
+	// The decorator may have been generated without the dimensions of textures still being loaded.
+	for (int i = 0; i < decorator->GetNumTextures(); i++)
+		TextureDatabase::AddWaitingElement(*decorator->GetTexture(i), element);
 	element_decorator.decorator = std::move(decorator);
 
 	decorators.push_back(element_decorator);
@@ -93,7 +103,8 @@ void ElementDecoration::ReleaseDecorators()
 void ElementDecoration::RenderDecorators()
 {
 	// @performance: Ignore dirty flag if e.g. pseudo classes do not affect the decorators
-	if (decorators_dirty)
+	// Translucent elements don't share decorator geometry, so the decorators are also reloaded when the element becomes translucent or opaque.
+	if (decorators_dirty || (!decorators.empty() && decorators_translucent != (element->GetComputedValues().opacity < 1.f)))
 	{
 		decorators_dirty = false;
 		ReloadDecorators();
@@ -80,6 +80,8 @@ private:
 
 	// If set, a full reload is necessary
 	bool decorators_dirty;
+	// True if the decorators were loaded while the element was translucent.
+	bool decorators_translucent;
 };
 
 } // namespace Rml
@@ -34,8 +34,10 @@
 #include "../../Include/RmlUi/Core/StreamMemory.h"
 #include "../../Include/RmlUi/Core/StyleSheet.h"
 #include "DocumentHeader.h"
+#include "ElementIndex.h"
 #include "ElementStyle.h"
 #include "EventDispatcher.h"
+#include "FrameStatisticsScope.h"
 #include "LayoutEngine.h"
 #include "StreamFile.h"
 #include "StyleSheetFactory.h"
@@ -56,6 +58,9 @@ ElementDocument::ElementDocument(const String& tag) : Element(tag)
 	position_dirty = false;
 
 	ForceLocalStackingContext();
+
+	// Documents are their own owner, and index all the elements they own.
+	element_index = MakeUnique<ElementIndex>();
 	SetOwnerDocument(this);
 
 	SetProperty(PropertyId::Position, Property(Style::Position::Absolute));
@@ -63,6 +68,8 @@ ElementDocument::ElementDocument(const String& tag) : Element(tag)
 
 ElementDocument::~ElementDocument()
 {
+	// Our children are destroyed after us, make sure they don't try to erase themselves from the destroyed index.
+	element_index.reset();
 }
 
 void ElementDocument::ProcessHeader(const DocumentHeader* document_header)
@@ -417,6 +424,14 @@ void ElementDocument::UpdateLayout()
 		RMLUI_ZoneScoped;
 		RMLUI_ZoneText(source_url.c_str(), source_url.size());
 
+		FrameStatistics* statistics = FrameStatisticsScope::GetActive();
+		FrameStatisticsScope statistics_scope(statistics, &FrameStatistics::layout_time);
+		if (statistics)
+		{
+			statistics->num_layouts += 1;
+			statistics->layout_documents.push_back(source_url);
+		}
+
 		Vector2f containing_block(0, 0);
 		if (GetParentNode() != nullptr)
 			containing_block = GetParentNode()->GetBox().GetSize();
@@ -0,0 +1,228 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "ElementIndex.h"
+#include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/ElementDocument.h"
+#include "ElementStyle.h"
+#include <algorithm>
+
+namespace Rml {
+
+ElementIndex* ElementIndex::GetFor(Element* element)
+{
+	ElementDocument* document = element->GetOwnerDocument();
+	return document ? document->element_index.get() : nullptr;
+}
+
+void ElementIndex::Insert(Element* element)
+{
+	InsertInto(tags, element->GetTagName(), element);
+
+	if (!element->GetId().empty())
+		InsertInto(ids, element->GetId(), element);
+
+	for (const String& class_name : element->GetStyle()->GetClassNameList())
+		InsertInto(classes, class_name, element);
+}
+
+void ElementIndex::Erase(Element* element)
+{
+	EraseFrom(tags, element->GetTagName(), element);
+
+	if (!element->GetId().empty())
+		EraseFrom(ids, element->GetId(), element);
+
+	for (const String& class_name : element->GetStyle()->GetClassNameList())
+		EraseFrom(classes, class_name, element);
+}
+
+void ElementIndex::InsertId(Element* element, const String& id)
+{
+	if (!id.empty())
+		InsertInto(ids, id, element);
+}
+
+void ElementIndex::EraseId(Element* element, const String& id)
+{
+	if (!id.empty())
+		EraseFrom(ids, id, element);
+}
+
+void ElementIndex::InsertClass(Element* element, const String& class_name)
+{
+	InsertInto(classes, class_name, element);
+}
+
+void ElementIndex::EraseClass(Element* element, const String& class_name)
+{
+	EraseFrom(classes, class_name, element);
+}
+
+Element* ElementIndex::GetElementById(Element* root_element, const String& id)
+{
+	// Elements with an empty id are not indexed.
+	if (id.empty())
+		return nullptr;
+
+	sets.assign(1, Find(KeyType::Id, id));
+
+	ElementList elements;
+	FindDescendants(elements, sets, root_element, true, true);
+
+	return elements.empty() ? nullptr : elements.front();
+}
+
+void ElementIndex::GetElementsByTagName(ElementList& elements, Element* root_element, const String& tag)
+{
+	sets.assign(1, Find(KeyType::Tag, tag));
+	FindDescendants(elements, sets, root_element, false, true);
+}
+
+void ElementIndex::GetElementsByClassName(ElementList& elements, Element* root_element, const String& class_name)
+{
+	sets.assign(1, Find(KeyType::Class, class_name));
+	FindDescendants(elements, sets, root_element, false, true);
+}
+
+void ElementIndex::GetElementsByKeys(ElementList& elements, Element* root_element, const Vector<Key>& keys)
+{
+	sets.clear();
+	for (const Key& key : keys)
+		sets.push_back(Find(key.type, key.name));
+
+	FindDescendants(elements, sets, root_element, false, false);
+}
+
+void ElementIndex::InsertInto(IndexMap& map, const String& key, Element* element)
+{
+	map[key].insert(element);
+}
+
+void ElementIndex::EraseFrom(IndexMap& map, const String& key, Element* element)
+{
+	auto it = map.find(key);
+	if (it == map.end())
+		return;
+
+	it->second.erase(element);
+	if (it->second.empty())
+		map.erase(it);
+}
+
+const ElementIndex::ElementHashSet* ElementIndex::Find(KeyType type, const String& key) const
+{
+	const IndexMap& map = (type == KeyType::Id ? ids : (type == KeyType::Tag ? tags : classes));
+
+	auto it = map.find(key);
+	if (it == map.end())
+		return nullptr;
+
+	return &it->second;
+}
+
+void ElementIndex::FindDescendants(ElementList& elements, const Vector<const ElementHashSet*>& in_sets, Element* root_element, bool include_root, bool breadth_first)
+{
+	candidates.clear();
+	child_indices.clear();
+
+	for (const ElementHashSet* set : in_sets)
+	{
+		if (!set)
+			continue;
+
+		// Find the path of child indices from the root to each candidate. This also rejects candidates outside the root's
+		// subtree, and those only reachable through non-DOM children, which are never searched.
+		for (Element* element : *set)
+		{
+			if (element == root_element)
+			{
+				if (include_root)
+					candidates.push_back(Candidate{ element, {} });
+				continue;
+			}
+
+			Candidate candidate{ element, {} };
+			bool is_descendant = false;
+
+			for (Element* child = element; Element* parent = child->GetParentNode(); child = parent)
+			{
+				// Index the DOM children of each parent once, so that each step up is constant time.
+				if (child_indices.find(child) == child_indices.end())
+				{
+					const int num_children = parent->GetNumChildren();
+					for (int i = 0; i < num_children; i++)
+						child_indices[parent->GetChild(i)] = i;
+				}
+
+				auto it_index = child_indices.find(child);
+				if (it_index == child_indices.end())
+					break;
+
+				candidate.path.push_back(it_index->second);
+
+				if (parent == root_element)
+				{
+					is_descendant = true;
+					break;
+				}
+			}
+
+			if (is_descendant)
+			{
+				std::reverse(candidate.path.begin(), candidate.path.end());
+				candidates.push_back(std::move(candidate));
+			}
+		}
+	}
+
+	if (breadth_first)
+	{
+		// Shallower elements first, then document order among elements at the same depth.
+		std::sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b) {
+			if (a.path.size() != b.path.size())
+				return a.path.size() < b.path.size();
+			return a.path < b.path;
+		});
+	}
+	else
+	{
+		// Lexicographic order of the paths is document order, with ancestors before their descendants.
+		std::sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b) { return a.path < b.path; });
+	}
+
+	// Elements found through several sets have equal paths and end up next to each other.
+	candidates.erase(std::unique(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b) { return a.element == b.element; }),
+		candidates.end());
+
+	elements.reserve(elements.size() + candidates.size());
+	for (const Candidate& candidate : candidates)
+		elements.push_back(candidate.element);
+}
+
+} // namespace Rml
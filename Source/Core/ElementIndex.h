@@ -0,0 +1,104 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_ELEMENTINDEX_H
+#define RMLUI_CORE_ELEMENTINDEX_H
+
+#include "../../Include/RmlUi/Core/Header.h"
+#include "../../Include/RmlUi/Core/Traits.h"
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+class Element;
+
+/**
+	Indexes all the elements of a document by their id, tag and classes, to accelerate element lookups.
+
+	Elements are added to the index of their owner document when attached to it, and removed when detached. Changes to
+	an attached element's id or classes must be reported to the index before they take effect on the element.
+ */
+
+class ElementIndex : public NonCopyMoveable {
+public:
+	// Returns the index of the given element's owner document, or nullptr if the element is not part of a document.
+	static ElementIndex* GetFor(Element* element);
+
+	// Adds or removes the element along with its id, tag and classes.
+	void Insert(Element* element);
+	void Erase(Element* element);
+
+	void InsertId(Element* element, const String& id);
+	void EraseId(Element* element, const String& id);
+
+	void InsertClass(Element* element, const String& class_name);
+	void EraseClass(Element* element, const String& class_name);
+
+	// Returns the first element with the given id in a breadth-first search of the root and its descendants.
+	Element* GetElementById(Element* root_element, const String& id);
+	// Finds the descendants of the root with the given tag or class, in breadth-first order.
+	void GetElementsByTagName(ElementList& elements, Element* root_element, const String& tag);
+	void GetElementsByClassName(ElementList& elements, Element* root_element, const String& class_name);
+
+	enum class KeyType { Id, Tag, Class };
+	struct Key {
+		KeyType type;
+		String name;
+	};
+	// Finds the descendants of the root matching any of the given keys, in document order.
+	void GetElementsByKeys(ElementList& elements, Element* root_element, const Vector<Key>& keys);
+
+private:
+	using ElementHashSet = UnorderedSet<Element*>;
+	using IndexMap = UnorderedMap<String, ElementHashSet>;
+
+	static void InsertInto(IndexMap& map, const String& key, Element* element);
+	static void EraseFrom(IndexMap& map, const String& key, Element* element);
+
+	const ElementHashSet* Find(KeyType type, const String& key) const;
+
+	// Adds the elements of the given sets that are DOM descendants of the root to the list, without duplicates.
+	// @param[in] breadth_first Sorts the elements in breadth-first order if true, otherwise in document order.
+	void FindDescendants(ElementList& elements, const Vector<const ElementHashSet*>& sets, Element* root_element, bool include_root, bool breadth_first);
+
+	IndexMap ids;
+	IndexMap tags;
+	IndexMap classes;
+
+	// Working memory reused between lookups.
+	struct Candidate {
+		Element* element;
+		Vector<int> path;
+	};
+	Vector<Candidate> candidates;
+	UnorderedMap<Element*, int> child_indices;
+	Vector<const ElementHashSet*> sets;
+};
+
+} // namespace Rml
+#endif
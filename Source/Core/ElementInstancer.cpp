@@ -44,6 +44,8 @@ static Pool< ElementText > pool_text_default(200, true);
 ElementPtr ElementInstancerElement::InstanceElement(Element* /*parent*/, const String& tag, const XMLAttributes& /*attributes*/)
 {
 	Element* ptr = pool_element.AllocateAndConstruct(tag);
+	ptr->update_every_frame = false;
+	ptr->render_within_border_box = true;
 	return ElementPtr(ptr);
 }
 
@@ -69,6 +71,7 @@ ElementInstancerElement::~ElementInstancerElement()
 ElementPtr ElementInstancerText::InstanceElement(Element* /*parent*/, const String& tag, const XMLAttributes& /*attributes*/)
 {
 	ElementText* ptr = pool_text_default.AllocateAndConstruct(tag);
+	ptr->update_every_frame = false;
 	return ElementPtr(static_cast<Element*>(ptr));
 }
 
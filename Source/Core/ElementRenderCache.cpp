@@ -0,0 +1,175 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "ElementRenderCache.h"
+#include "../../Include/RmlUi/Core/Context.h"
+#include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/ElementUtilities.h"
+#include "../../Include/RmlUi/Core/GeometryUtilities.h"
+#include "../../Include/RmlUi/Core/Math.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+#include "../../Include/RmlUi/Core/RenderInterface.h"
+#include "FrameStatisticsScope.h"
+#include "TransformState.h"
+
+namespace Rml {
+
+ElementRenderCache::ElementRenderCache()
+{}
+
+ElementRenderCache::~ElementRenderCache()
+{
+	ReleaseTexture();
+	if (context_num_render_caches)
+		*context_num_render_caches -= 1;
+}
+
+bool ElementRenderCache::Render(Element* element)
+{
+	if (unsupported)
+		return false;
+
+	RenderInterface* element_render_interface = element->GetRenderInterface();
+	Context* context = element->GetContext();
+	if (!element_render_interface || !context)
+		return false;
+
+	SetContext(context);
+
+	// The texture is rendered in screen space, transformed elements are rendered normally.
+	const TransformState* transform_state = element->GetTransformState();
+	if (transform_state && transform_state->GetTransform())
+		return false;
+
+	// Cache the element's border box and scrollable overflow, limited to the context's viewport.
+	const Vector2f border_origin = element->GetAbsoluteOffset(Box::BORDER);
+	const Vector2f client_origin = border_origin + Vector2f(element->GetClientLeft(), element->GetClientTop());
+
+	Vector2f region_min = border_origin;
+	Vector2f region_max = border_origin + element->GetBox().GetSize(Box::BORDER);
+	region_max.x = Math::Max(region_max.x, client_origin.x + element->GetScrollWidth());
+	region_max.y = Math::Max(region_max.y, client_origin.y + element->GetScrollHeight());
+
+	const Vector2f context_dimensions = Vector2f(context->GetDimensions());
+	region_min = Vector2f(Math::Max(region_min.x, 0.f), Math::Max(region_min.y, 0.f));
+	region_max = Vector2f(Math::Min(region_max.x, context_dimensions.x), Math::Min(region_max.y, context_dimensions.y));
+
+	const Vector2i origin(Math::RoundDownToInteger(region_min.x), Math::RoundDownToInteger(region_min.y));
+	const Vector2i dimensions(Math::RoundUpToInteger(region_max.x) - origin.x, Math::RoundUpToInteger(region_max.y) - origin.y);
+
+	// Nothing within the viewport to render.
+	if (dimensions.x <= 0 || dimensions.y <= 0)
+		return true;
+
+	if (dirty || !texture || render_interface != element_render_interface || origin != region_origin || dimensions != region_dimensions)
+	{
+		RMLUI_ZoneScopedN("RenderToTexture");
+
+		ReleaseTexture();
+
+		if (!element_render_interface->BeginRenderToTexture(origin, dimensions))
+		{
+			unsupported = true;
+			return false;
+		}
+
+		rendering = true;
+		element->Render();
+		rendering = false;
+
+		texture = element_render_interface->EndRenderToTexture();
+		if (!texture)
+		{
+			unsupported = true;
+			return false;
+		}
+
+		render_interface = element_render_interface;
+		region_origin = origin;
+		region_dimensions = dimensions;
+		dirty = false;
+	}
+
+	// Restore the render state of the element itself, which may have been changed by its descendants.
+	ElementUtilities::ApplyTransform(*element);
+	if (!ElementUtilities::SetClippingRegion(element))
+		return true;
+
+	// Opacity is already applied to the contents of the texture.
+	render_interface->ApplyOpacity(1.f);
+
+	Vertex vertices[4];
+	int indices[6];
+	GeometryUtilities::GenerateQuad(vertices, indices, Vector2f(0), Vector2f(region_dimensions), Colourb(255, 255, 255), Vector2f(0, 0), Vector2f(1, 1));
+
+	render_interface->RenderGeometry(vertices, 4, indices, 6, texture, Vector2f(region_origin));
+
+	FrameStatisticsScope::Add(&FrameStatistics::num_draw_calls);
+	FrameStatisticsScope::Add(&FrameStatistics::num_vertices, 4);
+
+	return true;
+}
+
+bool ElementRenderCache::IsRendering() const
+{
+	return rendering;
+}
+
+void ElementRenderCache::SetDirty()
+{
+	dirty = true;
+}
+
+bool ElementRenderCache::AnyCachesExist(Context* context)
+{
+	return *context->num_render_caches > 0;
+}
+
+void ElementRenderCache::SetContext(Context* context)
+{
+	if (context_num_render_caches == context->num_render_caches)
+		return;
+
+	// Changes made while we were counted in another context may not have dirtied us.
+	if (context_num_render_caches)
+		*context_num_render_caches -= 1;
+
+	context_num_render_caches = context->num_render_caches;
+	*context_num_render_caches += 1;
+	dirty = true;
+}
+
+void ElementRenderCache::ReleaseTexture()
+{
+	if (texture)
+		render_interface->ReleaseTexture(texture);
+
+	texture = 0;
+}
+
+} // namespace Rml
@@ -0,0 +1,91 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_ELEMENTRENDERCACHE_H
+#define RMLUI_CORE_ELEMENTRENDERCACHE_H
+
+#include "../../Include/RmlUi/Core/Header.h"
+#include "../../Include/RmlUi/Core/Traits.h"
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+class Context;
+class Element;
+class RenderInterface;
+
+/**
+	Caches the rendering of an element and its stacking context in an off-screen texture, enabled by the element's
+	'render-cache' attribute.
+
+	The subtree is rendered into the texture using the render interface's render-to-texture hooks, and afterwards drawn
+	as a single quad until the cache is dirtied by a change to the subtree or the element moves. Content outside the
+	element's border box and scrollable overflow is not cached, nor is anything outside the context's viewport.
+ */
+
+class ElementRenderCache : public NonCopyMoveable {
+public:
+	ElementRenderCache();
+	~ElementRenderCache();
+
+	// Renders the element from the cached texture, first rendering the element into the texture if it is dirty.
+	// @return False if the element cannot be cached and must be rendered normally.
+	bool Render(Element* element);
+
+	// Returns true while the element is being rendered into the texture.
+	bool IsRendering() const;
+
+	// Marks the texture as stale, so that it is rendered again the next time the element is rendered.
+	void SetDirty();
+
+	// Returns true if any render caches have been rendered in the given context, used to avoid searching for caches to
+	// dirty when there are none.
+	static bool AnyCachesExist(Context* context);
+
+private:
+	void ReleaseTexture();
+
+	// Counts this cache in the given context, and dirties it if it was previously counted in another context.
+	void SetContext(Context* context);
+
+	// The cache count of the context the cache was last rendered in.
+	SharedPtr<int> context_num_render_caches;
+
+	RenderInterface* render_interface = nullptr;
+	TextureHandle texture = 0;
+
+	Vector2i region_origin;
+	Vector2i region_dimensions;
+
+	bool dirty = true;
+	bool rendering = false;
+	bool unsupported = false;
+};
+
+} // namespace Rml
+#endif
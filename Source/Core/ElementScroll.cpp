@@ -56,6 +56,11 @@ void ElementScroll::Update()
 	}
 }
 
+bool ElementScroll::HasScrollbars() const
+{
+	return scrollbars[VERTICAL].widget || scrollbars[HORIZONTAL].widget;
+}
+
 // Enables and sizes one of the scrollbars.
 void ElementScroll::EnableScrollbar(Orientation orientation, float element_width)
 {
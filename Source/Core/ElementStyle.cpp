@@ -44,7 +44,9 @@
 #include "../../Include/RmlUi/Core/TransformPrimitive.h"
 #include "ElementDecoration.h"
 #include "ElementDefinition.h"
+#include "ElementIndex.h"
 #include "ComputeProperty.h"
+#include "FrameStatisticsScope.h"
 #include "PropertiesIterator.h"
 #include <algorithm>
 
@@ -189,6 +191,7 @@ void ElementStyle::UpdateDefinition()
 		if (auto& style_sheet = element->GetStyleSheet())
 		{
 			new_definition = style_sheet->GetElementDefinition(element);
+			FrameStatisticsScope::Add(&FrameStatistics::num_definitions_resolved);
 		}
 		
 		// Switch the property definitions if the definition has changed.
@@ -284,6 +287,9 @@ void ElementStyle::SetClass(const String& class_name, bool activate)
 		{
 			classes.push_back(class_name);
 			DirtyDefinition();
+
+			if (ElementIndex* index = ElementIndex::GetFor(element))
+				index->InsertClass(element, class_name);
 		}
 	}
 	else
@@ -292,6 +298,11 @@ void ElementStyle::SetClass(const String& class_name, bool activate)
 		{
 			classes.erase(class_location);
 			DirtyDefinition();
+
+			// The class may have been listed more than once through the class attribute.
+			ElementIndex* index = ElementIndex::GetFor(element);
+			if (index && !IsClassSet(class_name))
+				index->EraseClass(element, class_name);
 		}
 	}
 }
@@ -305,9 +316,22 @@ bool ElementStyle::IsClassSet(const String& class_name) const
 // Specifies the entire list of classes for this element. This will replace any others specified.
 void ElementStyle::SetClassNames(const String& class_names)
 {
+	ElementIndex* index = ElementIndex::GetFor(element);
+	if (index)
+	{
+		for (const String& class_name : classes)
+			index->EraseClass(element, class_name);
+	}
+
 	classes.clear();
 	StringUtilities::ExpandString(classes, class_names, ' ');
 	DirtyDefinition();
+
+	if (index)
+	{
+		for (const String& class_name : classes)
+			index->InsertClass(element, class_name);
+	}
 }
 
 // Returns the list of classes specified for this element.
@@ -326,6 +350,12 @@ String ElementStyle::GetClassNames() const
 	return class_names;
 }
 
+// Returns the list of classes specified for this element.
+const StringList& ElementStyle::GetClassNameList() const
+{
+	return classes;
+}
+
 // Sets a local property override on the element to a pre-parsed value.
 bool ElementStyle::SetProperty(PropertyId id, const Property& property)
 {
@@ -341,6 +371,57 @@ bool ElementStyle::SetProperty(PropertyId id, const Property& property)
 	return true;
 }
 
+bool ElementStyle::SetPropertyDirect(PropertyId id, const Property& property, Style::ComputedValues& values, bool& value_changed)
+{
+	Colourb* colour_value = nullptr;
+	Property::Unit expected_unit = Property::COLOUR;
+
+	switch (id)
+	{
+	case PropertyId::BackgroundColor:   colour_value = &values.background_color; break;
+	case PropertyId::BorderTopColor:    colour_value = &values.border_top_color; break;
+	case PropertyId::BorderRightColor:  colour_value = &values.border_right_color; break;
+	case PropertyId::BorderBottomColor: colour_value = &values.border_bottom_color; break;
+	case PropertyId::BorderLeftColor:   colour_value = &values.border_left_color; break;
+	case PropertyId::ImageColor:        colour_value = &values.image_color; break;
+	case PropertyId::Opacity:           expected_unit = Property::NUMBER; break;
+	case PropertyId::Transform:         expected_unit = Property::TRANSFORM; break;
+	default:
+		return false;
+	}
+
+	if (property.unit != expected_unit)
+		return false;
+
+	Property new_property = property;
+	new_property.definition = StyleSheetSpecification::GetProperty(id);
+	if (!new_property.definition)
+		return false;
+
+	inline_properties.SetProperty(id, new_property);
+
+	if (colour_value)
+	{
+		const Colourb new_colour = property.Get<Colourb>();
+		value_changed = (new_colour != *colour_value);
+		*colour_value = new_colour;
+	}
+	else if (id == PropertyId::Opacity)
+	{
+		const float new_opacity = property.Get<float>();
+		value_changed = (new_opacity != values.opacity);
+		values.opacity = new_opacity;
+	}
+	else
+	{
+		TransformPtr new_transform = property.Get<TransformPtr>();
+		value_changed = (new_transform != values.transform);
+		values.transform = std::move(new_transform);
+	}
+
+	return true;
+}
+
 // Removes a local property override on the element.
 void ElementStyle::RemoveProperty(PropertyId id)
 {
@@ -470,11 +551,13 @@ float ElementStyle::ResolveLength(const Property* property, RelativeTarget relat
 void ElementStyle::DirtyDefinition()
 {
 	definition_dirty = true;
+	element->DirtyUpdate();
 }
 
 void ElementStyle::DirtyInheritedProperties()
 {
 	dirty_properties |= StyleSheetSpecification::GetRegisteredInheritedProperties();
+	element->DirtyUpdate();
 }
 
 void ElementStyle::DirtyChildDefinitions()
@@ -533,12 +616,17 @@ PropertiesIterator ElementStyle::Iterate() const {
 void ElementStyle::DirtyProperty(PropertyId id)
 {
 	dirty_properties.Insert(id);
+	element->DirtyUpdate();
 }
 
 // Sets a list of properties as dirty.
 void ElementStyle::DirtyProperties(const PropertyIdSet& properties)
 {
+	if (properties.Empty())
+		return;
+
 	dirty_properties |= properties;
+	element->DirtyUpdate();
 }
 
 PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const Style::ComputedValues* parent_values, const Style::ComputedValues* document_values, bool values_are_default_initialized, float dp_ratio, Vector2f vp_dimensions)
@@ -548,6 +636,8 @@ PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const S
 
 	RMLUI_ZoneScopedC(0xFF7F50);
 
+	FrameStatisticsScope::Add(&FrameStatistics::num_properties_computed, (int)dirty_properties.Size());
+
 	// Generally, this is how it works:
 	//   1. Assign default values (clears any removed properties)
 	//   2. Inherit inheritable values from parent
@@ -978,6 +1068,9 @@ PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const S
 		{
 			auto child = element->GetChild(i);
 			child->GetStyle()->dirty_properties |= dirty_inherited_properties;
+
+			// The children are visited right after this element during update, so only they need to be marked.
+			child->update_dirty = true;
 		}
 	}
 	
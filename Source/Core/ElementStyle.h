@@ -90,11 +90,20 @@ public:
 	/// Return the active class list.
 	/// @return A string containing all the classes on the element, separated by spaces.
 	String GetClassNames() const;
+	/// Return the active class list.
+	/// @return The list of classes on the element.
+	const StringList& GetClassNameList() const;
 
 	/// Sets a local property override on the element to a pre-parsed value.
 	/// @param[in] name The name of the new property.
 	/// @param[in] property The parsed property to set.
 	bool SetProperty(PropertyId id, const Property& property);
+	/// Sets a local property override and writes its computed value directly, without dirtying the property. Only
+	/// supported for properties which don't affect layout, that is colours, opacity and transform, for use by animations.
+	/// @note Opacity is inherited, its value must be propagated to any descendants by the caller.
+	/// @param[out] value_changed True if the computed value was changed.
+	/// @return False if the property is not supported, in which case nothing is changed.
+	bool SetPropertyDirect(PropertyId id, const Property& property, Style::ComputedValues& values, bool& value_changed);
 	/// Removes a local property override on the element; its value will revert to that defined in
 	/// the style sheet.
 	/// @param[in] name The name of the local property definition to remove.
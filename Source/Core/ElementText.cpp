@@ -29,6 +29,7 @@
 #include "../../Include/RmlUi/Core/ElementText.h"
 #include "ElementDefinition.h"
 #include "ElementStyle.h"
+#include "FrameStatisticsScope.h"
 #include "../../Include/RmlUi/Core/Core.h"
 #include "../../Include/RmlUi/Core/Context.h"
 #include "../../Include/RmlUi/Core/ElementDocument.h"
@@ -352,13 +353,10 @@ void ElementText::OnPropertyChange(const PropertyIdSet& changed_properties)
 	bool font_face_changed = false;
 	auto& computed = GetComputedValues();
 
-	if (changed_properties.Contains(PropertyId::Color) ||
-		changed_properties.Contains(PropertyId::Opacity))
+	if (changed_properties.Contains(PropertyId::Color))
 	{
 		// Fetch our (potentially) new colour.
-		Colourb new_colour = computed.color;
-		float opacity = computed.opacity;
-		new_colour.alpha = byte(opacity * float(new_colour.alpha));
+		const Colourb new_colour = computed.color;
 		colour_changed = colour != new_colour;
 		if (colour_changed)
 			colour = new_colour;
@@ -445,6 +443,8 @@ void ElementText::GenerateGeometry(const FontFaceHandle font_face_handle)
 {
 	RMLUI_ZoneScopedC(0xD2691E);
 
+	FrameStatisticsScope::Add(&FrameStatistics::num_geometry_generated);
+
 	// Release the old geometry ...
 	for (size_t i = 0; i < geometry.size(); ++i)
 		geometry[i].Release(true);
@@ -470,7 +470,9 @@ void ElementText::GenerateGeometry(const FontFaceHandle font_face_handle, Line&
 void ElementText::GenerateDecoration(const FontFaceHandle font_face_handle)
 {
 	RMLUI_ZoneScopedC(0xA52A2A);
-	
+
+	FrameStatisticsScope::Add(&FrameStatistics::num_geometry_generated);
+
 	for(const Line& line : lines)
 		GeometryUtilities::GenerateLine(font_face_handle, &decoration, line.position, line.width, decoration_property, colour);
 }
@@ -37,6 +37,7 @@
 #include "DataController.h"
 #include "DataModel.h"
 #include "DataView.h"
+#include "ElementIndex.h"
 #include "ElementStyle.h"
 #include "LayoutDetails.h"
 #include "LayoutEngine.h"
@@ -77,6 +78,13 @@ static void SetElementOffset(Element* element, Vector2f offset)
 
 Element* ElementUtilities::GetElementById(Element* root_element, const String& id)
 {
+	// Use the index of the element's document when available.
+	if (ElementIndex* index = ElementIndex::GetFor(root_element))
+	{
+		if (!id.empty())
+			return index->GetElementById(root_element, id);
+	}
+
 	// Breadth first search on elements for the corresponding id
 	typedef Queue<Element*> SearchQueue;
 	SearchQueue search_queue;
@@ -102,6 +110,12 @@ Element* ElementUtilities::GetElementById(Element* root_element, const String& i
 
 void ElementUtilities::GetElementsByTagName(ElementList& elements, Element* root_element, const String& tag)
 {
+	if (ElementIndex* index = ElementIndex::GetFor(root_element))
+	{
+		index->GetElementsByTagName(elements, root_element, tag);
+		return;
+	}
+
 	// Breadth first search on elements for the corresponding id
 	typedef Queue< Element* > SearchQueue;
 	SearchQueue search_queue;
@@ -124,6 +138,12 @@ void ElementUtilities::GetElementsByTagName(ElementList& elements, Element* root
 
 void ElementUtilities::GetElementsByClassName(ElementList& elements, Element* root_element, const String& class_name)
 {
+	if (ElementIndex* index = ElementIndex::GetFor(root_element))
+	{
+		index->GetElementsByClassName(elements, root_element, class_name);
+		return;
+	}
+
 	// Breadth first search on elements for the corresponding id
 	typedef Queue< Element* > SearchQueue;
 	SearchQueue search_queue;
@@ -177,56 +197,54 @@ void ElementUtilities::BindEventAttributes(Element* element)
 	}
 }
 	
-// Generates the clipping region for an element.
-bool ElementUtilities::GetClippingRegion(Vector2i& clip_origin, Vector2i& clip_dimensions, Element* element)
+// Merges the client area of the element with the clipping region, if the element clips any overflowing content.
+static void MergeClientClippingRegion(Vector2i& clip_origin, Vector2i& clip_dimensions, Element* clipping_element)
 {
-	clip_origin = Vector2i(-1, -1);
-	clip_dimensions = Vector2i(-1, -1);
-	
-	int num_ignored_clips = element->GetClippingIgnoreDepth();
-	if (num_ignored_clips < 0)
-		return false;
+	if (!clipping_element->IsClippingEnabled())
+		return;
 
+	// Ignore nodes that don't clip.
+	if (clipping_element->GetClientWidth() < clipping_element->GetScrollWidth() - 0.5f
+		|| clipping_element->GetClientHeight() < clipping_element->GetScrollHeight() - 0.5f)
+	{
+		const Box::Area client_area = clipping_element->GetClientArea();
+		const Vector2f element_origin_f = clipping_element->GetAbsoluteOffset(client_area);
+		const Vector2f element_dimensions_f = clipping_element->GetBox().GetSize(client_area);
+		
+		const Vector2i element_origin(Math::RealToInteger(element_origin_f.x), Math::RealToInteger(element_origin_f.y));
+		const Vector2i element_dimensions(Math::RealToInteger(element_dimensions_f.x), Math::RealToInteger(element_dimensions_f.y));
+		
+		if (clip_origin == Vector2i(-1, -1) && clip_dimensions == Vector2i(-1, -1))
+		{
+			clip_origin = element_origin;
+			clip_dimensions = element_dimensions;
+		}
+		else
+		{
+			const Vector2i top_left(Math::Max(clip_origin.x, element_origin.x),
+			                        Math::Max(clip_origin.y, element_origin.y));
+			
+			const Vector2i bottom_right(Math::Min(clip_origin.x + clip_dimensions.x, element_origin.x + element_dimensions.x),
+			                            Math::Min(clip_origin.y + clip_dimensions.y, element_origin.y + element_dimensions.y));
+			
+			clip_origin = top_left;
+			clip_dimensions.x = Math::Max(0, bottom_right.x - top_left.x);
+			clip_dimensions.y = Math::Max(0, bottom_right.y - top_left.y);
+		}
+	}
+}
+
+// Merges the clipping regions of the given element and its ancestors into the clipping region, skipping the given number of regions.
+static void AccumulateClippingRegion(Vector2i& clip_origin, Vector2i& clip_dimensions, Element* clipping_element, int num_ignored_clips)
+{
 	// Search through the element's ancestors, finding all elements that clip their overflow and have overflow to clip.
 	// For each that we find, we combine their clipping region with the existing clipping region, and so build up a
 	// complete clipping region for the element.
-	Element* clipping_element = element->GetParentNode();
-
 	while (clipping_element != nullptr)
 	{
 		// Merge the existing clip region with the current clip region if we aren't ignoring clip regions.
-		if (num_ignored_clips == 0 && clipping_element->IsClippingEnabled())
-		{
-			// Ignore nodes that don't clip.
-			if (clipping_element->GetClientWidth() < clipping_element->GetScrollWidth() - 0.5f
-				|| clipping_element->GetClientHeight() < clipping_element->GetScrollHeight() - 0.5f)
-			{
-				const Box::Area client_area = clipping_element->GetClientArea();
-				const Vector2f element_origin_f = clipping_element->GetAbsoluteOffset(client_area);
-				const Vector2f element_dimensions_f = clipping_element->GetBox().GetSize(client_area);
-				
-				const Vector2i element_origin(Math::RealToInteger(element_origin_f.x), Math::RealToInteger(element_origin_f.y));
-				const Vector2i element_dimensions(Math::RealToInteger(element_dimensions_f.x), Math::RealToInteger(element_dimensions_f.y));
-				
-				if (clip_origin == Vector2i(-1, -1) && clip_dimensions == Vector2i(-1, -1))
-				{
-					clip_origin = element_origin;
-					clip_dimensions = element_dimensions;
-				}
-				else
-				{
-					const Vector2i top_left(Math::Max(clip_origin.x, element_origin.x),
-					                        Math::Max(clip_origin.y, element_origin.y));
-					
-					const Vector2i bottom_right(Math::Min(clip_origin.x + clip_dimensions.x, element_origin.x + element_dimensions.x),
-					                            Math::Min(clip_origin.y + clip_dimensions.y, element_origin.y + element_dimensions.y));
-					
-					clip_origin = top_left;
-					clip_dimensions.x = Math::Max(0, bottom_right.x - top_left.x);
-					clip_dimensions.y = Math::Max(0, bottom_right.y - top_left.y);
-				}
-			}
-		}
+		if (num_ignored_clips == 0)
+			MergeClientClippingRegion(clip_origin, clip_dimensions, clipping_element);
 
 		// If this region is meant to clip and we're skipping regions, update the counter.
 		if (num_ignored_clips > 0)
@@ -246,10 +264,63 @@ bool ElementUtilities::GetClippingRegion(Vector2i& clip_origin, Vector2i& clip_d
 		// Climb the tree to this region's parent.
 		clipping_element = clipping_element->GetParentNode();
 	}
+}
+
+// Generates the clipping region for an element.
+bool ElementUtilities::GetClippingRegion(Vector2i& clip_origin, Vector2i& clip_dimensions, Element* element)
+{
+	clip_origin = Vector2i(-1, -1);
+	clip_dimensions = Vector2i(-1, -1);
 	
+	int num_ignored_clips = element->GetClippingIgnoreDepth();
+	if (num_ignored_clips < 0)
+		return false;
+
+	// During rendering, the region of elements which don't ignore any clipping regions is simply their parent's
+	// descendant region, which is cached so that we avoid walking all the ancestors for every rendered element.
+	Element* parent = element->GetParentNode();
+	if (num_ignored_clips == 0 && parent)
+	{
+		Context* context = element->GetContext();
+		if (context && context->render_pass != 0)
+			return GetDescendantClippingRegion(clip_origin, clip_dimensions, parent, context->render_pass);
+	}
+
+	AccumulateClippingRegion(clip_origin, clip_dimensions, parent, num_ignored_clips);
+
 	return clip_dimensions.x >= 0 && clip_dimensions.y >= 0;
 }
 
+bool ElementUtilities::GetDescendantClippingRegion(Vector2i& clip_origin, Vector2i& clip_dimensions, Element* element, unsigned int render_pass)
+{
+	Element::DescendantClipCache& cache = element->descendant_clip_cache;
+
+	if (cache.render_pass != render_pass)
+	{
+		cache.render_pass = render_pass;
+		cache.origin = Vector2i(-1, -1);
+		cache.dimensions = Vector2i(-1, -1);
+
+		// Start with the region of our ancestors, as seen by us after ignoring any regions.
+		const int num_ignored_clips = element->GetClippingIgnoreDepth();
+		Element* parent = element->GetParentNode();
+
+		if (num_ignored_clips == 0 && parent)
+			GetDescendantClippingRegion(cache.origin, cache.dimensions, parent, render_pass);
+		else if (num_ignored_clips > 0)
+			AccumulateClippingRegion(cache.origin, cache.dimensions, parent, num_ignored_clips);
+
+		MergeClientClippingRegion(cache.origin, cache.dimensions, element);
+
+		cache.clip = (cache.dimensions.x >= 0 && cache.dimensions.y >= 0);
+	}
+
+	clip_origin = cache.origin;
+	clip_dimensions = cache.dimensions;
+
+	return cache.clip;
+}
+
 // Sets the clipping region from an element and its ancestors.
 bool ElementUtilities::SetClippingRegion(Element* element, Context* context)
 {	
@@ -70,6 +70,9 @@ bool ElementImage::GetIntrinsicDimensions(Vector2f& _dimensions, float& _ratio)
 	else
 		dimensions.y = (float)texture.GetDimensions(GetRenderInterface()).y;
 
+	// We need to be laid out again once the texture is loaded if it is still loading.
+	TextureDatabase::AddWaitingElement(texture, this);
+
 	// Return the calculated dimensions. If this changes the size of the element, it will result in
 	// a call to 'onresize' below which will regenerate the geometry.
 	_dimensions = dimensions;
@@ -132,8 +135,7 @@ void ElementImage::OnPropertyChange(const PropertyIdSet& changed_properties)
 {
     Element::OnPropertyChange(changed_properties);
 
-    if (changed_properties.Contains(PropertyId::ImageColor) ||
-        changed_properties.Contains(PropertyId::Opacity)) {
+    if (changed_properties.Contains(PropertyId::ImageColor)) {
         GenerateGeometry();
     }
 }
@@ -147,6 +149,17 @@ void ElementImage::OnChildAdd(Element* child)
 	}
 }
 
+void ElementImage::OnTexturesLoaded()
+{
+	Element::OnTexturesLoaded();
+
+	geometry_dirty = true;
+
+	// The intrinsic dimensions were taken from the texture before it was loaded.
+	if (dimensions.x == 0 || dimensions.y == 0)
+		DirtyLayout();
+}
+
 // Regenerates the element's geometry.
 void ElementImage::OnResize()
 {
@@ -188,9 +201,7 @@ void ElementImage::GenerateGeometry()
 
 	const ComputedValues& computed = GetComputedValues();
 
-	float opacity = computed.opacity;
-	Colourb quad_colour = computed.image_color;
-    quad_colour.alpha = (byte)(opacity * (float)quad_colour.alpha);
+	const Colourb quad_colour = computed.image_color;
 	
 	Vector2f quad_size = GetBox().GetSize(Box::CONTENT).Round();
 
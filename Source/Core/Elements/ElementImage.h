@@ -93,6 +93,9 @@ protected:
 	/// Detect when we have been added to the document.
 	void OnChildAdd(Element* child) override;
 
+	/// Regenerates the image geometry, and its layout if it was sized from a texture that was still loading.
+	void OnTexturesLoaded() override;
+
 private:
 	// Generates the element's geometry.
 	void GenerateGeometry();
@@ -37,8 +37,30 @@ Event::Event()
 }
 
 Event::Event(Element* _target_element, EventId id, const String& type, const Dictionary& _parameters, bool interruptible)
-	: parameters(_parameters), target_element(_target_element), type(type), id(id), interruptible(interruptible)
 {
+	Reset(_target_element, id, type, _parameters, interruptible);
+}
+
+Event::~Event()
+{
+}
+
+void Event::Reset(Element* _target_element, EventId _id, const String& _type, const Dictionary& _parameters, bool _interruptible)
+{
+	// Assigning in place lets the containers reuse their previously allocated memory.
+	parameters = _parameters;
+	target_element = _target_element;
+	current_element = nullptr;
+	type = _type;
+	id = _id;
+	interruptible = _interruptible;
+	interrupted = false;
+	interrupted_immediate = false;
+	phase = EventPhase::None;
+
+	has_mouse_position = false;
+	mouse_screen_position = Vector2f(0, 0);
+
 	const Variant* mouse_x = GetIf(parameters, "mouse_x");
 	const Variant* mouse_y = GetIf(parameters, "mouse_y");
 	if (mouse_x && mouse_y)
@@ -49,10 +71,6 @@ Event::Event(Element* _target_element, EventId id, const String& type, const Dic
 	}
 }
 
-Event::~Event()
-{
-}
-
 void Event::SetCurrentElement(Element* element)
 {
 	current_element = element;
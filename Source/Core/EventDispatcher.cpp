@@ -27,6 +27,7 @@
  */
 
 #include "EventDispatcher.h"
+#include "../../Include/RmlUi/Core/Context.h"
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/Event.h"
 #include "../../Include/RmlUi/Core/EventListener.h"
@@ -107,32 +108,46 @@ void EventDispatcher::DetachAllEvents()
 		element->GetChild(i)->GetEventDispatcher()->DetachAllEvents();
 }
 
-/*
-	CollectedListener
+CollectedListener::CollectedListener(Element* _element, EventListener* _listener, int dom_distance_from_target, bool in_capture_phase) :
+	element(_element->GetObserverPtr()), listener(_listener->GetObserverPtr())
+{
+	sort = dom_distance_from_target * (in_capture_phase ? -1 : 1);
+}
 
-	When dispatching an event we collect all possible event listeners to execute.
-	They are stored in observer pointers, so that we can safely check if they have been destroyed since the previous listener execution.
-*/
-struct CollectedListener {
 
-	CollectedListener(Element* _element, EventListener* _listener, int dom_distance_from_target, bool in_capture_phase) : element(_element->GetObserverPtr()), listener(_listener->GetObserverPtr())
+class EventDispatchBuffersScope : NonCopyMoveable {
+public:
+	EventDispatchBuffersScope(Context* context) : context(context)
 	{
-		sort = dom_distance_from_target * (in_capture_phase ? -1 : 1);
-	}
-
-	// The sort value is determined by the distance of the element to the target element in the DOM.
-	// Capture phase is given negative values.
-	int sort = 0;
+		if (!context)
+		{
+			// Elements outside any context use their own buffers.
+			local_buffers = MakeUnique<EventDispatchBuffers>();
+			buffers = local_buffers.get();
+			return;
+		}
 
-	ObserverPtr<Element> element;
-	ObserverPtr<EventListener> listener;
+		if (context->event_dispatch_depth >= (int)context->event_dispatch_buffers.size())
+			context->event_dispatch_buffers.push_back(MakeUnique<EventDispatchBuffers>());
+		buffers = context->event_dispatch_buffers[context->event_dispatch_depth].get();
+		context->event_dispatch_depth += 1;
+	}
+	~EventDispatchBuffersScope()
+	{
+		// Clear the buffers while keeping their capacity, the observer pointers must not outlive the dispatch.
+		buffers->element_path.clear();
+		buffers->listeners.clear();
+		buffers->default_action_elements.clear();
+		if (context)
+			context->event_dispatch_depth -= 1;
+	}
 
-	// Default actions are returned by EventPhase::None.
-	EventPhase GetPhase() const { return sort < 0 ? EventPhase::Capture : (sort == 0 ? EventPhase::Target : EventPhase::Bubble); }
+	EventDispatchBuffers& Get() { return *buffers; }
 
-	bool operator<(const CollectedListener& other) const {
-		return sort < other.sort;
-	}
+private:
+	Context* context;
+	EventDispatchBuffers* buffers;
+	UniquePtr<EventDispatchBuffers> local_buffers;
 };
 
 
@@ -140,20 +155,16 @@ bool EventDispatcher::DispatchEvent(Element* target_element, const EventId id, c
 {
 	RMLUI_ASSERTMSG(!((int)default_action_phase & (int)EventPhase::Capture), "We assume here that the default action phases cannot include capture phase.");
 
-	Vector<CollectedListener> listeners;
-	Vector<ObserverPtr<Element>> default_action_elements;
+	EventDispatchBuffersScope buffers_scope(target_element ? target_element->GetContext() : nullptr);
+	Vector<Element*>& element_path = buffers_scope.Get().element_path;
+	Vector<CollectedListener>& listeners = buffers_scope.Get().listeners;
+	Vector<ObserverPtr<Element>>& default_action_elements = buffers_scope.Get().default_action_elements;
 
-	const EventPhase phases_to_execute = EventPhase((int)EventPhase::Capture | (int)EventPhase::Target | (bubbles ? (int)EventPhase::Bubble : 0));
-	
-	// Walk the DOM tree from target to root, collecting all possible listeners and elements with default actions in the process.
-	int dom_distance_from_target = 0;
+	// Walk the DOM tree from target to root, collecting the path and all elements with default actions in the process.
 	Element* walk_element = target_element;
 	while (walk_element)
 	{
-		EventDispatcher* dispatcher = walk_element->GetEventDispatcher();
-		dispatcher->CollectListeners(dom_distance_from_target, id, phases_to_execute, listeners);
-
-		if(dom_distance_from_target == 0)
+		if(element_path.empty())
 		{
 			if ((int)default_action_phase & (int)EventPhase::Target)
 				default_action_elements.push_back(walk_element->GetObserverPtr());
@@ -163,16 +174,29 @@ bool EventDispatcher::DispatchEvent(Element* target_element, const EventId id, c
 			default_action_elements.push_back(walk_element->GetObserverPtr());
 		}
 
+		element_path.push_back(walk_element);
 		walk_element = walk_element->GetParentNode();
-		dom_distance_from_target += 1;
+	}
+
+	// Collect all listeners in the order they are executed, that is, capture phase from the root down to the target, then
+	// the target phase, and finally bubble phase back up to the root. The order of the listeners in each element is maintained.
+	const int path_length = (int)element_path.size();
+
+	for (int dom_distance_from_target = path_length - 1; dom_distance_from_target >= 1; dom_distance_from_target--)
+		element_path[dom_distance_from_target]->GetEventDispatcher()->CollectListeners(dom_distance_from_target, id, EventPhase::Capture, listeners);
+
+	if (path_length > 0)
+		element_path[0]->GetEventDispatcher()->CollectListeners(0, id, EventPhase::Target, listeners);
+
+	if (bubbles)
+	{
+		for (int dom_distance_from_target = 1; dom_distance_from_target < path_length; dom_distance_from_target++)
+			element_path[dom_distance_from_target]->GetEventDispatcher()->CollectListeners(dom_distance_from_target, id, EventPhase::Bubble, listeners);
 	}
 
 	if (listeners.empty() && default_action_elements.empty())
 		return true;
 
-	// Use stable_sort so that the order of the listeners in a given element is maintained.
-	std::stable_sort(listeners.begin(), listeners.end());
-
 	// Instance event
 	EventPtr event = Factory::InstanceEvent(target_element, id, type, parameters, interruptible);
 	if (!event)
@@ -36,7 +36,6 @@ namespace Rml {
 
 class Element;
 class EventListener;
-struct CollectedListener;
 
 struct EventListenerEntry {
 	EventListenerEntry(EventId id, EventListener* listener, bool in_capture_phase) : id(id), in_capture_phase(in_capture_phase), listener(listener) {}
@@ -45,6 +44,40 @@ struct EventListenerEntry {
 	EventListener* listener;
 };
 
+/*
+	CollectedListener
+
+	When dispatching an event we collect all possible event listeners to execute.
+	They are stored in observer pointers, so that we can safely check if they have been destroyed since the previous listener execution.
+*/
+struct CollectedListener {
+
+	CollectedListener(Element* element, EventListener* listener, int dom_distance_from_target, bool in_capture_phase);
+
+	// The sort value is determined by the distance of the element to the target element in the DOM.
+	// Capture phase is given negative values.
+	int sort = 0;
+
+	ObserverPtr<Element> element;
+	ObserverPtr<EventListener> listener;
+
+	// Default actions are returned by EventPhase::None.
+	EventPhase GetPhase() const { return sort < 0 ? EventPhase::Capture : (sort == 0 ? EventPhase::Target : EventPhase::Bubble); }
+};
+
+/*
+	EventDispatchBuffers
+
+	Scratch memory used during event dispatch, owned by the context and reused between dispatches so that high-frequency
+	events don't allocate. Listeners may dispatch new events while processing an event, thus, every nesting level gets
+	its own set of buffers.
+*/
+struct EventDispatchBuffers {
+	Vector<Element*> element_path;
+	Vector<CollectedListener> listeners;
+	Vector<ObserverPtr<Element>> default_action_elements;
+};
+
 
 /**
 	The Event Dispatcher manages a list of event listeners and triggers the events via EventHandlers
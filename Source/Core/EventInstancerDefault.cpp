@@ -37,17 +37,27 @@ EventInstancerDefault::EventInstancerDefault()
 
 EventInstancerDefault::~EventInstancerDefault()
 {
+	for (Event* event : unused_events)
+		delete event;
 }
 
 EventPtr EventInstancerDefault::InstanceEvent(Element* target, EventId id, const String& type, const Dictionary& parameters, bool interruptible)
 {
+	if (!unused_events.empty())
+	{
+		Event* event = unused_events.back();
+		unused_events.pop_back();
+		event->Reset(target, id, type, parameters, interruptible);
+		return EventPtr(event);
+	}
+
 	return EventPtr(new Event(target, id, type, parameters, interruptible));
 }
 
 // Releases an event instanced by this instancer.
 void EventInstancerDefault::ReleaseEvent(Event* event)
 {
-	delete event;
+	unused_events.push_back(event);
 }
 
 void EventInstancerDefault::Release()
@@ -59,6 +59,10 @@ public:
 
 	/// Releases this event instancer.
 	void Release() override;
+
+private:
+	// Released events are kept for reuse, so that high-frequency events such as mouse moves don't allocate.
+	Vector<Event*> unused_events;
 };
 
 } // namespace Rml
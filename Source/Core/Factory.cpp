@@ -496,7 +496,8 @@ ElementPtr Factory::InstanceDocumentStream(Context* context, Stream* stream, con
 	document->context = context;
 
 	XMLParser parser(element.get());
-	parser.Parse(stream);
+	if (!parser.Parse(stream))
+		return nullptr;
 
 	return element;
 }
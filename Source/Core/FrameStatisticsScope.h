@@ -0,0 +1,74 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_FRAMESTATISTICSSCOPE_H
+#define RMLUI_CORE_FRAMESTATISTICSSCOPE_H
+
+#include "../../Include/RmlUi/Core/FrameStatistics.h"
+#include "../../Include/RmlUi/Core/Traits.h"
+#include <chrono>
+
+namespace Rml {
+
+/**
+	Makes the statistics of a context active for recording while in scope, and adds the time spent in the scope to one of its phases.
+
+	Recording sites throughout the library add to the active statistics, if any, so that counters don't need to be
+	passed around. Scopes may be nested, such as for the layout phase within the update.
+ */
+
+class FrameStatisticsScope : public NonCopyMoveable {
+public:
+	// @param[in] statistics The statistics to record into, or nullptr to leave the active statistics unchanged and not time the scope.
+	// @param[in] phase_time The member of the statistics to add the time spent in this scope to.
+	FrameStatisticsScope(FrameStatistics* statistics, double FrameStatistics::* phase_time);
+	~FrameStatisticsScope();
+
+	// Returns the statistics being recorded into, or nullptr when no context is being updated or rendered.
+	static FrameStatistics* GetActive() { return active; }
+
+	// Adds to the given counter of the active statistics, if any.
+	static void Add(int FrameStatistics::* counter, int value = 1)
+	{
+		if (active)
+			active->*counter += value;
+	}
+
+private:
+	using Clock = std::chrono::steady_clock;
+
+	FrameStatistics* statistics;
+	FrameStatistics* previous;
+	double FrameStatistics::* phase_time;
+	Clock::time_point start;
+
+	static FrameStatistics* active;
+};
+
+} // namespace Rml
+#endif
@@ -32,12 +32,23 @@
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/RenderInterface.h"
+#include "FrameStatisticsScope.h"
+#include "GeometryArena.h"
 #include "GeometryDatabase.h"
+#include "TextureResource.h"
 #include <utility>
 
 
 namespace Rml {
 
+// Vertices with an opacity multiplied into their colours, compiled if the renderer supports it.
+struct GeometryOpacityCopy {
+	float opacity = -1.f;
+	Vector< Vertex > vertices;
+	CompiledGeometryHandle compiled_geometry = 0;
+	bool compile_attempted = false;
+};
+
 Geometry::Geometry(Element* host_element) : host_element(host_element)
 {
 	database_handle = GeometryDatabase::Insert(this);
@@ -73,6 +84,22 @@ void Geometry::MoveFrom(Geometry& other)
 
 	compiled_geometry = std::exchange(other.compiled_geometry, 0);
 	compile_attempted = std::exchange(other.compile_attempted, false);
+	compiled_texture_handle = std::exchange(other.compiled_texture_handle, 0);
+
+	opacity_copy = std::move(other.opacity_copy);
+
+	atlas_applied = std::exchange(other.atlas_applied, false);
+	atlas_texcoord_offset = other.atlas_texcoord_offset;
+	atlas_texcoord_scale = other.atlas_texcoord_scale;
+
+	if (arena)
+		arena->Erase(arena_handle);
+
+	arena = std::exchange(other.arena, nullptr);
+	arena_handle = std::exchange(other.arena_handle, -1);
+
+	if (arena)
+		arena->SetOwner(arena_handle, this);
 }
 
 Geometry::~Geometry()
@@ -80,6 +107,9 @@ Geometry::~Geometry()
 	GeometryDatabase::Erase(database_handle);
 
 	Release();
+
+	if (arena)
+		arena->Erase(arena_handle);
 }
 
 // Set the host element for this geometry; this should be passed in the constructor if possible.
@@ -105,26 +135,77 @@ void Geometry::Render(Vector2f translation)
 
 	translation = translation.Round();
 
+	if (!arena && !vertices.empty() && !indices.empty())
+		CommitToArena();
+
+	Vertex* vertex_data = vertices.data();
+	int num_vertices = (int)vertices.size();
+	int* index_data = indices.data();
+	int num_indices = (int)indices.size();
+
+	if (arena)
+	{
+		vertex_data = arena->GetVertices(arena_handle);
+		num_vertices = arena->GetNumVertices(arena_handle);
+		index_data = arena->GetIndices(arena_handle);
+		num_indices = arena->GetNumIndices(arena_handle);
+	}
+
+	if (texture && texture->resource)
+	{
+		// Make sure the texture is loaded, so that we know whether it was packed into an atlas.
+		const TextureHandle texture_handle = texture->resource->GetHandle(render_interface);
+
+		// Render nothing in place of a texture which is still being loaded asynchronously.
+		if (texture->resource->IsLoading())
+		{
+			if (host_element)
+				texture->resource->AddWaitingElement(host_element);
+			return;
+		}
+
+		// The texture may have been evicted and loaded again with a new handle since we were compiled.
+		if (texture_handle != compiled_texture_handle)
+		{
+			Release();
+			compiled_texture_handle = texture_handle;
+		}
+
+		ApplyTextureAtlas(render_interface, vertex_data, num_vertices);
+	}
+
+	if (render_interface->opacity < 1.f && !render_interface->opacity_applied_by_renderer)
+	{
+		RenderWithOpacity(render_interface, translation, render_interface->opacity, vertex_data, num_vertices, index_data, num_indices);
+		return;
+	}
+
 	// Render our compiled geometry if possible.
 	if (compiled_geometry)
 	{
 		RMLUI_ZoneScopedN("RenderCompiled");
 		render_interface->RenderCompiledGeometry(compiled_geometry, translation);
+
+		FrameStatisticsScope::Add(&FrameStatistics::num_draw_calls);
+		FrameStatisticsScope::Add(&FrameStatistics::num_vertices, num_vertices);
 	}
 	// Otherwise, if we actually have geometry, try to compile it if we haven't already done so, otherwise render it in
 	// immediate mode.
 	else
 	{
-		if (vertices.empty() ||
-			indices.empty())
+		if (num_vertices == 0 ||
+			num_indices == 0)
 			return;
 
 		RMLUI_ZoneScopedN("RenderGeometry");
 
+		FrameStatisticsScope::Add(&FrameStatistics::num_draw_calls);
+		FrameStatisticsScope::Add(&FrameStatistics::num_vertices, num_vertices);
+
 		if (!compile_attempted)
 		{
 			compile_attempted = true;
-			compiled_geometry = render_interface->CompileGeometry(&vertices[0], (int)vertices.size(), &indices[0], (int)indices.size(), texture ? texture->GetHandle(render_interface) : 0);
+			compiled_geometry = render_interface->CompileGeometry(vertex_data, num_vertices, index_data, num_indices, texture ? texture->GetHandle(render_interface) : 0);
 
 			// If we managed to compile the geometry, we can clear the local copy of vertices and indices and
 			// immediately render the compiled version.
@@ -137,19 +218,23 @@ void Geometry::Render(Vector2f translation)
 
 		// Either we've attempted to compile before (and failed), or the compile we just attempted failed; either way,
 		// render the uncompiled version.
-		render_interface->RenderGeometry(&vertices[0], (int)vertices.size(), &indices[0], (int)indices.size(), texture ? texture->GetHandle(GetRenderInterface()) : 0, translation);
+		render_interface->RenderGeometry(vertex_data, num_vertices, index_data, num_indices, texture ? texture->GetHandle(GetRenderInterface()) : 0, translation);
 	}
 }
 
 // Returns the geometry's vertices. If these are written to, Release() should be called to force a recompile.
 Vector< Vertex >& Geometry::GetVertices()
 {
+	ExtractFromArena();
+	// The vertices are returned with the texture coordinates of our texture itself, rather than of any atlas page.
+	RestoreTextureAtlas(vertices.data(), (int)vertices.size());
 	return vertices;
 }
 
 // Returns the geometry's indices. If these are written to, Release() should be called to force a recompile.
 Vector< int >& Geometry::GetIndices()
 {
+	ExtractFromArena();
 	return indices;
 }
 
@@ -176,16 +261,135 @@ void Geometry::Release(bool clear_buffers)
 
 	compile_attempted = false;
 
+	ReleaseOpacityCopy();
+
 	if (clear_buffers)
 	{
 		vertices.clear();
 		indices.clear();
+		atlas_applied = false;
+
+		if (arena)
+		{
+			arena->Erase(arena_handle);
+			arena = nullptr;
+			arena_handle = -1;
+		}
 	}
 }
 
 Geometry::operator bool() const
 {
-	return !indices.empty();
+	return arena || !indices.empty();
+}
+
+void Geometry::ApplyTextureAtlas(RenderInterface* render_interface, Vertex* vertex_data, int num_vertices)
+{
+	Vector2f texcoord_offset, texcoord_scale;
+	const bool packed = texture->resource->GetAtlasRegion(render_interface, texcoord_offset, texcoord_scale);
+
+	if (packed == atlas_applied && (!packed || (texcoord_offset == atlas_texcoord_offset && texcoord_scale == atlas_texcoord_scale)))
+		return;
+
+	// The texture has been packed, unpacked, or packed again since we were compiled.
+	Release();
+	RestoreTextureAtlas(vertex_data, num_vertices);
+
+	if (packed)
+	{
+		for (int i = 0; i < num_vertices; i++)
+			vertex_data[i].tex_coord = texcoord_offset + vertex_data[i].tex_coord * texcoord_scale;
+
+		atlas_applied = true;
+		atlas_texcoord_offset = texcoord_offset;
+		atlas_texcoord_scale = texcoord_scale;
+	}
+}
+
+void Geometry::RestoreTextureAtlas(Vertex* vertex_data, int num_vertices)
+{
+	if (!atlas_applied)
+		return;
+
+	for (int i = 0; i < num_vertices; i++)
+		vertex_data[i].tex_coord = (vertex_data[i].tex_coord - atlas_texcoord_offset) / atlas_texcoord_scale;
+
+	atlas_applied = false;
+}
+
+void Geometry::RenderWithOpacity(RenderInterface* render_interface, Vector2f translation, float opacity, Vertex* vertex_data, int num_vertices, int* index_data, int num_indices)
+{
+	if (num_vertices == 0 || num_indices == 0)
+		return;
+
+	RMLUI_ZoneScopedN("RenderGeometryOpacity");
+
+	FrameStatisticsScope::Add(&FrameStatistics::num_draw_calls);
+	FrameStatisticsScope::Add(&FrameStatistics::num_vertices, num_vertices);
+
+	if (!opacity_copy)
+		opacity_copy = MakeUnique<GeometryOpacityCopy>();
+
+	GeometryOpacityCopy& copy = *opacity_copy;
+
+	// Only rewrite the vertex colours when the opacity has changed since the copy was last made.
+	if (copy.opacity != opacity)
+	{
+		if (copy.compiled_geometry)
+		{
+			render_interface->ReleaseCompiledGeometry(copy.compiled_geometry);
+			copy.compiled_geometry = 0;
+		}
+		copy.compile_attempted = false;
+		copy.opacity = opacity;
+
+		copy.vertices.assign(vertex_data, vertex_data + num_vertices);
+		for (Vertex& vertex : copy.vertices)
+			vertex.colour.alpha = (byte)(opacity * (float)vertex.colour.alpha);
+	}
+
+	const TextureHandle texture_handle = (texture ? texture->GetHandle(render_interface) : 0);
+
+	if (!copy.compile_attempted)
+	{
+		copy.compile_attempted = true;
+		copy.compiled_geometry = render_interface->CompileGeometry(copy.vertices.data(), num_vertices, index_data, num_indices, texture_handle);
+	}
+
+	if (copy.compiled_geometry)
+		render_interface->RenderCompiledGeometry(copy.compiled_geometry, translation);
+	else
+		render_interface->RenderGeometry(copy.vertices.data(), num_vertices, index_data, num_indices, texture_handle, translation);
+}
+
+void Geometry::ReleaseOpacityCopy()
+{
+	if (!opacity_copy)
+		return;
+
+	if (opacity_copy->compiled_geometry)
+		GetRenderInterface()->ReleaseCompiledGeometry(opacity_copy->compiled_geometry);
+
+	opacity_copy.reset();
+}
+
+void Geometry::CommitToArena()
+{
+	if (!host_context || !host_context->geometry_arena)
+		return;
+
+	arena = host_context->geometry_arena.get();
+	arena_handle = arena->Insert(this, vertices, indices);
+}
+
+void Geometry::ExtractFromArena()
+{
+	if (!arena)
+		return;
+
+	arena->Extract(arena_handle, vertices, indices);
+	arena = nullptr;
+	arena_handle = -1;
 }
 
 // Returns the host context's render interface.
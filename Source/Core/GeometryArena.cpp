@@ -0,0 +1,185 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "GeometryArena.h"
+#include "../../Include/RmlUi/Core/Geometry.h"
+#include <algorithm>
+
+namespace Rml {
+
+GeometryArena::~GeometryArena()
+{
+	for (Handle handle = 0; handle < (Handle)ranges.size(); handle++)
+	{
+		Geometry* owner = ranges[handle].owner;
+		if (!owner)
+			continue;
+
+		Extract(handle, owner->vertices, owner->indices);
+		owner->arena = nullptr;
+		owner->arena_handle = -1;
+	}
+}
+
+GeometryArena::Handle GeometryArena::Insert(Geometry* owner, Vector<Vertex>& in_vertices, Vector<int>& in_indices)
+{
+	RMLUI_ASSERT(owner);
+
+	Handle handle;
+	if (!free_handles.empty())
+	{
+		handle = free_handles.back();
+		free_handles.pop_back();
+	}
+	else
+	{
+		handle = (Handle)ranges.size();
+		ranges.emplace_back();
+	}
+
+	Range& range = ranges[handle];
+	range.owner = owner;
+	range.vertex_offset = (int)vertices.size();
+	range.num_vertices = (int)in_vertices.size();
+	range.index_offset = (int)indices.size();
+	range.num_indices = (int)in_indices.size();
+
+	vertices.insert(vertices.end(), in_vertices.begin(), in_vertices.end());
+	indices.insert(indices.end(), in_indices.begin(), in_indices.end());
+
+	// Swap with empty buffers to actually release the memory, that's the point of the arena.
+	Vector<Vertex>().swap(in_vertices);
+	Vector<int>().swap(in_indices);
+
+	return handle;
+}
+
+void GeometryArena::Extract(Handle handle, Vector<Vertex>& out_vertices, Vector<int>& out_indices)
+{
+	const Range& range = ranges[handle];
+	RMLUI_ASSERT(range.owner);
+
+	out_vertices.assign(vertices.begin() + range.vertex_offset, vertices.begin() + range.vertex_offset + range.num_vertices);
+	out_indices.assign(indices.begin() + range.index_offset, indices.begin() + range.index_offset + range.num_indices);
+
+	Erase(handle);
+}
+
+void GeometryArena::Erase(Handle handle)
+{
+	Range& range = ranges[handle];
+	RMLUI_ASSERT(range.owner);
+
+	num_unused_vertices += range.num_vertices;
+	num_unused_indices += range.num_indices;
+
+	range = Range{};
+	free_handles.push_back(handle);
+
+	const bool compact_vertices = (num_unused_vertices >= MinCompactSize && 2 * num_unused_vertices > (int)vertices.size());
+	const bool compact_indices = (num_unused_indices >= MinCompactSize && 2 * num_unused_indices > (int)indices.size());
+
+	if (compact_vertices || compact_indices)
+		Compact();
+}
+
+void GeometryArena::SetOwner(Handle handle, Geometry* owner)
+{
+	RMLUI_ASSERT(ranges[handle].owner && owner);
+	ranges[handle].owner = owner;
+}
+
+Vertex* GeometryArena::GetVertices(Handle handle)
+{
+	return vertices.data() + ranges[handle].vertex_offset;
+}
+
+int GeometryArena::GetNumVertices(Handle handle) const
+{
+	return ranges[handle].num_vertices;
+}
+
+int* GeometryArena::GetIndices(Handle handle)
+{
+	return indices.data() + ranges[handle].index_offset;
+}
+
+int GeometryArena::GetNumIndices(Handle handle) const
+{
+	return ranges[handle].num_indices;
+}
+
+int GeometryArena::GetVertexBufferSize() const
+{
+	return (int)vertices.size();
+}
+
+int GeometryArena::GetIndexBufferSize() const
+{
+	return (int)indices.size();
+}
+
+void GeometryArena::Compact()
+{
+	// Ranges are always appended, so their vertex and index offsets are ordered the same way.
+	Vector<Range*> used_ranges;
+	used_ranges.reserve(ranges.size() - free_handles.size());
+
+	for (Range& range : ranges)
+	{
+		if (range.owner)
+			used_ranges.push_back(&range);
+	}
+
+	std::sort(used_ranges.begin(), used_ranges.end(), [](const Range* a, const Range* b) { return a->vertex_offset < b->vertex_offset; });
+
+	// Each range moves towards the front, never past the start of its previous location, so copying forward is safe.
+	int vertex_offset = 0;
+	int index_offset = 0;
+
+	for (Range* range : used_ranges)
+	{
+		std::copy(vertices.begin() + range->vertex_offset, vertices.begin() + range->vertex_offset + range->num_vertices, vertices.begin() + vertex_offset);
+		std::copy(indices.begin() + range->index_offset, indices.begin() + range->index_offset + range->num_indices, indices.begin() + index_offset);
+
+		range->vertex_offset = vertex_offset;
+		range->index_offset = index_offset;
+
+		vertex_offset += range->num_vertices;
+		index_offset += range->num_indices;
+	}
+
+	// Keep the capacity, so that it is reused by subsequent insertions.
+	vertices.resize(vertex_offset);
+	indices.resize(index_offset);
+
+	num_unused_vertices = 0;
+	num_unused_indices = 0;
+}
+
+} // namespace Rml
@@ -0,0 +1,104 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_GEOMETRYARENA_H
+#define RMLUI_CORE_GEOMETRYARENA_H
+
+#include "../../Include/RmlUi/Core/Header.h"
+#include "../../Include/RmlUi/Core/Traits.h"
+#include "../../Include/RmlUi/Core/Types.h"
+#include "../../Include/RmlUi/Core/Vertex.h"
+
+namespace Rml {
+
+class Geometry;
+
+/**
+	Stores the vertices and indices of many geometries in shared, contiguous buffers.
+
+	Each geometry is sub-allocated at the end of the buffers. Erased ranges are left as holes, which are reclaimed by
+	compacting the buffers once they make up a large part of them. Pointers into the buffers are therefore only valid
+	until the next insertion or erasure, while handles stay valid until their range is erased or extracted.
+
+	When destroyed, the arena moves all remaining data back into the buffers of the owning geometries.
+ */
+
+class GeometryArena : public NonCopyMoveable {
+public:
+	using Handle = int;
+
+	~GeometryArena();
+
+	// Moves the given vertices and indices into the arena, freeing the memory of the buffers.
+	// @param[in] owner The geometry owning the data, which is given back its data if the arena is destroyed first.
+	Handle Insert(Geometry* owner, Vector<Vertex>& vertices, Vector<int>& indices);
+	// Moves the data of the given range back into the given buffers, and erases the range.
+	void Extract(Handle handle, Vector<Vertex>& vertices, Vector<int>& indices);
+	// Erases the given range, its data is discarded.
+	void Erase(Handle handle);
+
+	// Updates the owner of the given range, such as after the owning geometry has been moved.
+	void SetOwner(Handle handle, Geometry* owner);
+
+	Vertex* GetVertices(Handle handle);
+	int GetNumVertices(Handle handle) const;
+	int* GetIndices(Handle handle);
+	int GetNumIndices(Handle handle) const;
+
+	// Returns the size of the shared buffers, including any unused holes.
+	int GetVertexBufferSize() const;
+	int GetIndexBufferSize() const;
+
+private:
+	// Buffers are not compacted while smaller than this, to avoid frequently compacting small buffers.
+	static constexpr int MinCompactSize = 1024;
+
+	struct Range {
+		Geometry* owner;
+		int vertex_offset;
+		int num_vertices;
+		int index_offset;
+		int num_indices;
+	};
+
+	// Moves all ranges in use to the front of the buffers, removing the holes between them.
+	void Compact();
+
+	Vector<Vertex> vertices;
+	Vector<int> indices;
+
+	// The ranges indexed by their handle, erased ranges have a null owner and their handle is reused.
+	Vector<Range> ranges;
+	Vector<Handle> free_handles;
+
+	int num_unused_vertices = 0;
+	int num_unused_indices = 0;
+};
+
+} // namespace Rml
+#endif
@@ -34,6 +34,10 @@
 
 namespace Rml {
 
+// The range of the number of points used to draw each rounded corner.
+static constexpr int MinNumArcPoints = 2;
+static constexpr int MaxNumArcPoints = 100;
+
 GeometryBackgroundBorder::GeometryBackgroundBorder(Vector<Vertex>& vertices, Vector<int>& indices) : vertices(vertices), indices(indices)
 {}
 
@@ -228,10 +232,8 @@ void GeometryBackgroundBorder::DrawBackgroundCorner(Corner corner, Vector2f pos_
 	}
 	else if (r.x > 0 && r.y > 0)
 	{
-		const float a0 = float((int)corner + 2) * 0.5f * Math::RMLUI_PI;
-		const float a1 = float((int)corner + 3) * 0.5f * Math::RMLUI_PI;
 		const int num_points = GetNumPoints(R);
-		DrawArc(pos_circle_center, r, a0, a1, color, color, num_points);
+		DrawArc(pos_circle_center, r, corner, color, color, num_points);
 	}
 }
 
@@ -245,7 +247,7 @@ void GeometryBackgroundBorder::DrawPoint(Vector2f pos, Colourb color)
 	vertices[offset_vertices].colour = color;
 }
 
-void GeometryBackgroundBorder::DrawArc(Vector2f pos_center, Vector2f r, float a0, float a1, Colourb color0, Colourb color1, int num_points)
+void GeometryBackgroundBorder::DrawArc(Vector2f pos_center, Vector2f r, Corner corner, Colourb color0, Colourb color1, int num_points)
 {
 	RMLUI_ASSERT(num_points >= 2 && r.x > 0 && r.y > 0);
 
@@ -257,10 +259,9 @@ void GeometryBackgroundBorder::DrawArc(Vector2f pos_center, Vector2f r, float a0
 	{
 		const float t = float(i) / float(num_points - 1);
 
-		const float a = Math::Lerp(t, a0, a1);
 		const Colourb color = Math::Lerp(t, color0, color1);
 
-		const Vector2f unit_vector(Math::Cos(a), Math::Sin(a));
+		const Vector2f unit_vector = GetArcUnitVector(corner, i, num_points);
 
 		vertices[offset_vertices + i].position = unit_vector * r + pos_center;
 		vertices[offset_vertices + i].colour = color;
@@ -286,20 +287,17 @@ void GeometryBackgroundBorder::FillBackground(int index_start)
 
 void GeometryBackgroundBorder::DrawBorderCorner(Corner corner, Vector2f pos_outer, Vector2f pos_inner, Vector2f pos_circle_center, float R, Vector2f r, Colourb color0, Colourb color1)
 {
-	const float a0 = float((int)corner + 2) * 0.5f * Math::RMLUI_PI;
-	const float a1 = float((int)corner + 3) * 0.5f * Math::RMLUI_PI;
-
 	if (R == 0)
 	{
 		DrawPointPoint(pos_outer, pos_inner, color0, color1);
 	}
 	else if (r.x > 0 && r.y > 0)
 	{
-		DrawArcArc(pos_circle_center, R, r, a0, a1, color0, color1, GetNumPoints(R));
+		DrawArcArc(pos_circle_center, R, r, corner, color0, color1, GetNumPoints(R));
 	}
 	else
 	{
-		DrawArcPoint(pos_circle_center, pos_inner, R, a0, a1, color0, color1, GetNumPoints(R));
+		DrawArcPoint(pos_circle_center, pos_inner, R, corner, color0, color1, GetNumPoints(R));
 	}
 }
 
@@ -319,7 +317,7 @@ void GeometryBackgroundBorder::DrawPointPoint(Vector2f pos_outer, Vector2f pos_i
 	}
 }
 
-void GeometryBackgroundBorder::DrawArcArc(Vector2f pos_center, float R, Vector2f r, float a0, float a1, Colourb color0, Colourb color1, int num_points)
+void GeometryBackgroundBorder::DrawArcArc(Vector2f pos_center, float R, Vector2f r, Corner corner, Colourb color0, Colourb color1, int num_points)
 {
 	RMLUI_ASSERT(num_points >= 2 && R > 0 && r.x > 0 && r.y > 0);
 
@@ -335,10 +333,9 @@ void GeometryBackgroundBorder::DrawArcArc(Vector2f pos_center, float R, Vector2f
 	{
 		const float t = float(i) / float(num_points - 1);
 
-		const float a = Math::Lerp(t, a0, a1);
 		const Colourb color = Math::Lerp(t, color0, color1);
 
-		const Vector2f unit_vector(Math::Cos(a), Math::Sin(a));
+		const Vector2f unit_vector = GetArcUnitVector(corner, i, num_points);
 
 		vertices[offset_vertices + 2 * i].position = unit_vector * r + pos_center;
 		vertices[offset_vertices + 2 * i].colour = color;
@@ -358,7 +355,7 @@ void GeometryBackgroundBorder::DrawArcArc(Vector2f pos_center, float R, Vector2f
 	}
 }
 
-void GeometryBackgroundBorder::DrawArcPoint(Vector2f pos_center, Vector2f pos_inner, float R, float a0, float a1, Colourb color0, Colourb color1, int num_points)
+void GeometryBackgroundBorder::DrawArcPoint(Vector2f pos_center, Vector2f pos_inner, float R, Corner corner, Colourb color0, Colourb color1, int num_points)
 {
 	RMLUI_ASSERT(R > 0 && num_points >= 2);
 
@@ -367,7 +364,7 @@ void GeometryBackgroundBorder::DrawArcPoint(Vector2f pos_center, Vector2f pos_in
 
 	// Generate the vertices. We could also split the arc mid-way to create a sharp color transition.
 	DrawPoint(pos_inner, color0);
-	DrawArc(pos_center, Vector2f(R), a0, a1, color0, color1, num_points);
+	DrawArc(pos_center, Vector2f(R), corner, color0, color1, num_points);
 	DrawPoint(pos_inner, color1);
 
 	RMLUI_ASSERT((int)vertices.size() - offset_vertices == num_points + 2);
@@ -415,7 +412,49 @@ void GeometryBackgroundBorder::FillEdge(int index_next_corner)
 
 int GeometryBackgroundBorder::GetNumPoints(float R) const
 {
-	return Math::Clamp(3 + Math::RoundToInteger(R / 6.f), 2, 100);
+	return Math::Clamp(3 + Math::RoundToInteger(R / 6.f), MinNumArcPoints, MaxNumArcPoints);
+}
+
+// The unit vectors along the top-left quarter circle, from angle pi to 1.5*pi, for every possible number of points.
+struct ArcTessellations {
+	ArcTessellations()
+	{
+		for (int num_points = MinNumArcPoints; num_points <= MaxNumArcPoints; num_points++)
+		{
+			offsets[num_points] = (int)unit_vectors.size();
+
+			for (int i = 0; i < num_points; i++)
+			{
+				const float t = float(i) / float(num_points - 1);
+				const float a = (1.f + 0.5f * t) * Math::RMLUI_PI;
+				unit_vectors.push_back(Vector2f(Math::Cos(a), Math::Sin(a)));
+			}
+		}
+	}
+
+	Array<int, MaxNumArcPoints + 1> offsets = {};
+	Vector<Vector2f> unit_vectors;
+};
+
+Vector2f GeometryBackgroundBorder::GetArcUnitVector(Corner corner, int i, int num_points)
+{
+	RMLUI_ASSERT(num_points >= MinNumArcPoints && num_points <= MaxNumArcPoints && i >= 0 && i < num_points);
+
+	// Initialized on first use, which is thread-safe.
+	static const ArcTessellations tessellations;
+
+	const Vector2f v = tessellations.unit_vectors[tessellations.offsets[num_points] + i];
+
+	// Each corner's quarter is rotated by another 90 degrees clockwise, which for these unit vectors is exact.
+	switch (corner)
+	{
+	case TOP_LEFT:     return v;
+	case TOP_RIGHT:    return Vector2f(-v.y, v.x);
+	case BOTTOM_RIGHT: return Vector2f(-v.x, -v.y);
+	case BOTTOM_LEFT:  return Vector2f(v.y, -v.x);
+	}
+
+	return v;
 }
 
 } // namespace Rml
@@ -0,0 +1,265 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "HitTestGrid.h"
+#include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+#include "TransformState.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+namespace Rml {
+
+static constexpr int MaxNumCellsPerAxis = 64;
+
+void HitTestGrid::SetDirty()
+{
+	dirty = true;
+}
+
+void HitTestGrid::DirtyElement(const Element* element)
+{
+	if (dirty)
+		return;
+
+	auto it = element_indices.find(element);
+	if (it == element_indices.end())
+		return;
+
+	Entry& entry = entries[it->second];
+	if (!entry.dirty)
+	{
+		entry.dirty = true;
+		dirty_indices.push_back(it->second);
+	}
+}
+
+void HitTestGrid::Update(const ElementList& stacking_context)
+{
+	// When most elements have changed, such as when the whole stacking context moves, it is cheaper to start over.
+	if (dirty || entries.size() != stacking_context.size() || 2 * dirty_indices.size() > entries.size())
+	{
+		Build(stacking_context);
+		return;
+	}
+
+	if (dirty_indices.empty())
+		return;
+
+	RMLUI_ZoneScoped;
+
+	for (int index : dirty_indices)
+	{
+		entries[index].dirty = false;
+		Remove(index);
+		Insert(index, stacking_context[index]);
+	}
+
+	dirty_indices.clear();
+}
+
+void HitTestGrid::Build(const ElementList& stacking_context)
+{
+	RMLUI_ZoneScoped;
+
+	dirty = false;
+
+	const int num_elements = (int)stacking_context.size();
+
+	unbounded_indices.clear();
+	cells.clear();
+	dirty_indices.clear();
+	entries.assign(num_elements, Entry());
+
+	element_indices.clear();
+	element_indices.reserve(num_elements);
+	for (int i = 0; i < num_elements; i++)
+		element_indices[stacking_context[i]] = i;
+
+	// Find the extent of all bounded elements to lay out the grid over.
+	Vector2f grid_top_left(FLT_MAX, FLT_MAX);
+	Vector2f grid_bottom_right(-FLT_MAX, -FLT_MAX);
+	int num_bounded_elements = 0;
+
+	for (Element* element : stacking_context)
+	{
+		Vector2f top_left, bottom_right;
+		if (!GetBounds(element, top_left, bottom_right))
+			continue;
+
+		grid_top_left = Vector2f(Math::Min(grid_top_left.x, top_left.x), Math::Min(grid_top_left.y, top_left.y));
+		grid_bottom_right = Vector2f(Math::Max(grid_bottom_right.x, bottom_right.x), Math::Max(grid_bottom_right.y, bottom_right.y));
+		num_bounded_elements += 1;
+	}
+
+	if (num_bounded_elements == 0)
+	{
+		// Still provide a single cell so that elements may become bounded later without a rebuild.
+		grid_top_left = Vector2f(0.f);
+		grid_bottom_right = Vector2f(0.f);
+	}
+
+	// Aim for a couple of elements per cell, assuming an even distribution.
+	const int num_cells_per_axis = Math::Clamp(int(std::sqrt(float(num_bounded_elements) * 0.5f)), 1, MaxNumCellsPerAxis);
+	num_cells = Vector2i(num_cells_per_axis, num_cells_per_axis);
+	origin = grid_top_left;
+
+	const Vector2f grid_size = grid_bottom_right - grid_top_left;
+	cell_size = Vector2f(Math::Max(grid_size.x / float(num_cells.x), 1.0f), Math::Max(grid_size.y / float(num_cells.y), 1.0f));
+
+	cells.resize(num_cells.x * num_cells.y);
+
+	// Elements are inserted in ascending order, so they are appended to the end of each cell.
+	for (int i = 0; i < num_elements; i++)
+		Insert(i, stacking_context[i]);
+}
+
+bool HitTestGrid::GetBounds(Element* element, Vector2f& top_left, Vector2f& bottom_right)
+{
+	// Elements with a local stacking context may contain hits in descendants outside their own boxes, and transformed
+	// elements are projected before testing. We cannot bound them here.
+	const TransformState* transform_state = element->GetTransformState();
+	if (element->local_stacking_context || (transform_state && transform_state->GetTransform()))
+		return false;
+
+	const Vector2f position = element->GetAbsoluteOffset(Box::BORDER);
+
+	top_left = Vector2f(FLT_MAX, FLT_MAX);
+	bottom_right = Vector2f(-FLT_MAX, -FLT_MAX);
+
+	for (int j = 0; j < element->GetNumBoxes(); j++)
+	{
+		Vector2f box_offset;
+		const Box& box = element->GetBox(j, box_offset);
+		const Vector2f box_top_left = position + box_offset;
+		const Vector2f box_bottom_right = box_top_left + box.GetSize(Box::BORDER);
+
+		top_left = Vector2f(Math::Min(top_left.x, box_top_left.x), Math::Min(top_left.y, box_top_left.y));
+		bottom_right = Vector2f(Math::Max(bottom_right.x, box_bottom_right.x), Math::Max(bottom_right.y, box_bottom_right.y));
+	}
+
+	return true;
+}
+
+void HitTestGrid::GetCellRange(Vector2f top_left, Vector2f bottom_right, Vector2i& first, Vector2i& last) const
+{
+	// Elements outside the grid are placed in the border cells, which also cover any points outside the grid when queried.
+	first.x = Math::Clamp(int(std::floor((top_left.x - origin.x) / cell_size.x)), 0, num_cells.x - 1);
+	first.y = Math::Clamp(int(std::floor((top_left.y - origin.y) / cell_size.y)), 0, num_cells.y - 1);
+	last.x = Math::Clamp(int(std::floor((bottom_right.x - origin.x) / cell_size.x)), 0, num_cells.x - 1);
+	last.y = Math::Clamp(int(std::floor((bottom_right.y - origin.y) / cell_size.y)), 0, num_cells.y - 1);
+}
+
+void HitTestGrid::Insert(int index, Element* element)
+{
+	auto insert_sorted = [index](Vector<int>& indices) {
+		if (indices.empty() || indices.back() < index)
+			indices.push_back(index);
+		else
+			indices.insert(std::lower_bound(indices.begin(), indices.end(), index), index);
+	};
+
+	Entry& entry = entries[index];
+	num_placed_elements += 1;
+
+	Vector2f top_left, bottom_right;
+	entry.bounded = GetBounds(element, top_left, bottom_right);
+	if (!entry.bounded)
+	{
+		insert_sorted(unbounded_indices);
+		return;
+	}
+
+	GetCellRange(top_left, bottom_right, entry.first_cell, entry.last_cell);
+	for (int y = entry.first_cell.y; y <= entry.last_cell.y; y++)
+		for (int x = entry.first_cell.x; x <= entry.last_cell.x; x++)
+			insert_sorted(cells[y * num_cells.x + x]);
+}
+
+void HitTestGrid::Remove(int index)
+{
+	auto erase_sorted = [index](Vector<int>& indices) {
+		auto it = std::lower_bound(indices.begin(), indices.end(), index);
+		if (it != indices.end() && *it == index)
+			indices.erase(it);
+	};
+
+	const Entry& entry = entries[index];
+	if (!entry.bounded)
+	{
+		erase_sorted(unbounded_indices);
+		return;
+	}
+
+	for (int y = entry.first_cell.y; y <= entry.last_cell.y; y++)
+		for (int x = entry.first_cell.x; x <= entry.last_cell.x; x++)
+			erase_sorted(cells[y * num_cells.x + x]);
+}
+
+const Vector<int>& HitTestGrid::QueryPoint(Vector2f point)
+{
+	candidates.clear();
+
+	const int* cell_begin = nullptr;
+	const int* cell_end = nullptr;
+
+	if (!cells.empty())
+	{
+		Vector2i cell_position;
+		GetCellRange(point, point, cell_position, cell_position);
+		const Vector<int>& cell = cells[cell_position.y * num_cells.x + cell_position.x];
+		cell_begin = cell.data();
+		cell_end = cell.data() + cell.size();
+	}
+
+	// Merge the cell and unbounded indices in descending order, which is the order elements are tested in.
+	const int* unbounded_begin = unbounded_indices.data();
+	const int* unbounded_end = unbounded_indices.data() + unbounded_indices.size();
+
+	candidates.reserve((cell_end - cell_begin) + (unbounded_end - unbounded_begin));
+
+	while (cell_end != cell_begin || unbounded_end != unbounded_begin)
+	{
+		if (unbounded_end == unbounded_begin || (cell_end != cell_begin && *(cell_end - 1) > *(unbounded_end - 1)))
+			candidates.push_back(*(--cell_end));
+		else
+			candidates.push_back(*(--unbounded_end));
+	}
+
+	return candidates;
+}
+
+#ifdef RMLUI_TESTS_ENABLED
+int HitTestGrid::GetNumPlacedElements(const Element* owner)
+{
+	return owner->hit_test_grid ? owner->hit_test_grid->num_placed_elements : 0;
+}
+#endif
+
+} // namespace Rml
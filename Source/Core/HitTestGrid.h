@@ -0,0 +1,114 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_HITTESTGRID_H
+#define RMLUI_CORE_HITTESTGRID_H
+
+#include "../../Include/RmlUi/Core/Header.h"
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+class Element;
+
+/**
+	A uniform grid over the border boxes of the elements in a local stacking context, used to accelerate hit testing.
+
+	The grid is conservative: Querying a point returns a superset of the stacking context elements which may contain
+	the point, the exact test is left to the caller. Elements whose hit area cannot be bounded by their own boxes, such
+	as transformed elements and elements with a local stacking context, are always returned as candidates.
+
+	Elements whose hit area changes are marked dirty individually, and only their entries are moved between cells on
+	the next query. The grid is only rebuilt from scratch when the stacking context changes, or most of it is dirty.
+ */
+
+class HitTestGrid {
+public:
+	// Stacking contexts with fewer elements than this are tested linearly instead.
+	static constexpr int MinNumElements = 32;
+
+	// Marks the grid for rebuilding, such as when the stacking context changes.
+	void SetDirty();
+	// Marks the entry of an element in the stacking context for updating, when its hit area may have changed.
+	void DirtyElement(const Element* element);
+
+	// Brings the grid up to date with the given stacking context, updating only the dirty entries when possible.
+	void Update(const ElementList& stacking_context);
+
+	// Returns the indices into the stacking context of all elements which may contain the given point, in descending order.
+	// @note The returned list is valid until the next call to this function.
+	const Vector<int>& QueryPoint(Vector2f point);
+
+#ifdef RMLUI_TESTS_ENABLED
+	// Returns the number of element entries placed into the hit test grid of the given stacking context owner since it was created.
+	static int GetNumPlacedElements(const Element* owner);
+#endif
+
+private:
+	struct Entry {
+		bool dirty = false;
+		bool bounded = false;
+		Vector2i first_cell, last_cell;
+	};
+
+	// Builds the grid from scratch.
+	void Build(const ElementList& stacking_context);
+
+	// Finds the bounds of the element's boxes, returns false if its hit area cannot be bounded by them.
+	static bool GetBounds(Element* element, Vector2f& top_left, Vector2f& bottom_right);
+	// Returns the range of cells covering the given bounds, clamped to the grid.
+	void GetCellRange(Vector2f top_left, Vector2f bottom_right, Vector2i& first, Vector2i& last) const;
+
+	// Places the entry of an element into the grid, or removes it, keeping every cell in ascending order.
+	void Insert(int index, Element* element);
+	void Remove(int index);
+
+	bool dirty = true;
+
+	Vector2f origin;
+	Vector2f cell_size;
+	Vector2i num_cells;
+
+	// The element indices in each cell, in ascending order.
+	Vector<Vector<int>> cells;
+
+	// Elements which must always be tested, in ascending order.
+	Vector<int> unbounded_indices;
+
+	// One entry per element in the stacking context, and the index of each element.
+	Vector<Entry> entries;
+	UnorderedMap<const Element*, int> element_indices;
+	Vector<int> dirty_indices;
+
+	int num_placed_elements = 0;
+
+	Vector<int> candidates;
+};
+
+} // namespace Rml
+#endif
@@ -63,6 +63,12 @@ bool RenderInterface::LoadTexture(TextureHandle& /*texture_handle*/, Vector2i& /
 	return false;
 }
 
+// Called by RmlUi when it wants the pixels of a texture, to pack it into an atlas.
+bool RenderInterface::LoadTextureData(UniquePtr<const byte[]>& /*data*/, Vector2i& /*dimensions*/, const String& /*source*/)
+{
+	return false;
+}
+
 // Called by RmlUi when a texture is required to be built from an internally-generated sequence of pixels.
 bool RenderInterface::GenerateTexture(TextureHandle& /*texture_handle*/, const byte* /*source*/, const Vector2i& /*source_dimensions*/)
 {
@@ -79,6 +85,33 @@ void RenderInterface::SetTransform(const Matrix4f* /*transform*/)
 {
 }
 
+// Called by RmlUi when it wants the renderer to apply a new opacity to subsequently rendered geometry.
+bool RenderInterface::SetOpacity(float /*opacity*/)
+{
+	return false;
+}
+
+void RenderInterface::ApplyOpacity(float new_opacity)
+{
+	if (new_opacity == opacity)
+		return;
+
+	opacity = new_opacity;
+	opacity_applied_by_renderer = SetOpacity(new_opacity);
+}
+
+// Called by RmlUi when it wants subsequent geometry to be rendered into a new off-screen texture.
+bool RenderInterface::BeginRenderToTexture(const Vector2i& /*origin*/, const Vector2i& /*dimensions*/)
+{
+	return false;
+}
+
+// Called by RmlUi when it has finished rendering into the off-screen texture.
+TextureHandle RenderInterface::EndRenderToTexture()
+{
+	return 0;
+}
+
 // Get the context currently being rendered.
 Context* RenderInterface::GetContext() const
 {
@@ -28,6 +28,7 @@
 
 #include "StyleSheetFactory.h"
 #include "../../Include/RmlUi/Core/StyleSheet.h"
+#include "CompiledSelector.h"
 #include "StyleSheetNode.h"
 #include "StreamFile.h"
 #include "StyleSheetNodeSelectorNthChild.h"
@@ -42,6 +43,7 @@
 #include "StyleSheetNodeSelectorOnlyOfType.h"
 #include "StyleSheetNodeSelectorEmpty.h"
 #include "../../Include/RmlUi/Core/Log.h"
+#include <algorithm>
 
 namespace Rml {
 
@@ -82,6 +84,7 @@ void StyleSheetFactory::Shutdown()
 	if (instance != nullptr)
 	{
 		ClearStyleSheetCache();
+		instance->compiled_selectors.clear();
 
 		for (SelectorMap::iterator i = instance->selectors.begin(); i != instance->selectors.end(); ++i)
 			delete (*i).second;
@@ -262,4 +265,28 @@ SharedPtr<StyleSheet> StyleSheetFactory::LoadStyleSheet(const String& sheet)
 	return new_style_sheet;
 }
 
+SharedPtr<const CompiledSelector> StyleSheetFactory::GetCompiledSelector(const String& selectors)
+{
+	const uint64_t use = ++instance->compiled_selector_use_counter;
+
+	auto it = instance->compiled_selectors.find(selectors);
+	if (it != instance->compiled_selectors.end())
+	{
+		it->second.last_use = use;
+		return it->second.selector;
+	}
+
+	if (instance->compiled_selectors.size() >= CompiledSelectorCacheSize)
+	{
+		auto it_oldest = std::min_element(instance->compiled_selectors.begin(), instance->compiled_selectors.end(),
+			[](const auto& a, const auto& b) { return a.second.last_use < b.second.last_use; });
+		instance->compiled_selectors.erase(it_oldest);
+	}
+
+	SharedPtr<const CompiledSelector> selector = MakeShared<CompiledSelector>(selectors);
+	instance->compiled_selectors.emplace(selectors, CompiledSelectorEntry{ selector, use });
+
+	return selector;
+}
+
 } // namespace Rml
@@ -33,6 +33,7 @@
 
 namespace Rml {
 
+class CompiledSelector;
 class StyleSheet;
 class StyleSheetNodeSelector;
 struct StructuralSelector;
@@ -68,6 +69,11 @@ public:
 	/// @return The selector registered with the given name, or nullptr if none exists.
 	static StructuralSelector GetSelector(const String& name);
 
+	/// Returns the given selectors compiled for matching elements, retrieving them from a cache of the most recently used selectors.
+	/// @param selectors[in] A list of comma-separated selectors.
+	/// @return The compiled selectors, which may not contain any valid selectors.
+	static SharedPtr<const CompiledSelector> GetCompiledSelector(const String& selectors);
+
 private:
 	StyleSheetFactory();
 	~StyleSheetFactory();
@@ -85,6 +91,15 @@ private:
 	// Custom complex selectors available for style sheets.
 	typedef UnorderedMap< String, StyleSheetNodeSelector* > SelectorMap;
 	SelectorMap selectors;
+
+	// Cache of compiled query selectors, the least recently used entry is evicted when full.
+	static constexpr size_t CompiledSelectorCacheSize = 64;
+	struct CompiledSelectorEntry {
+		SharedPtr<const CompiledSelector> selector;
+		uint64_t last_use;
+	};
+	UnorderedMap<String, CompiledSelectorEntry> compiled_selectors;
+	uint64_t compiled_selector_use_counter = 0;
 };
 
 } // namespace Rml
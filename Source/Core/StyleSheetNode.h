@@ -36,6 +36,7 @@
 
 namespace Rml {
 
+class CompiledSelector;
 class StyleSheetNodeSelector;
 
 struct StructuralSelector {
@@ -131,6 +132,8 @@ private:
 	PropertyDictionary properties;
 
 	StyleSheetNodeList children;
+
+	friend class Rml::CompiledSelector;
 };
 
 } // namespace Rml
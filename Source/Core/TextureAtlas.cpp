@@ -0,0 +1,227 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "TextureAtlas.h"
+#include "FrameStatisticsScope.h"
+#include "TextureLayout.h"
+#include "TextureResource.h"
+#include "../../Include/RmlUi/Core/Log.h"
+#include "../../Include/RmlUi/Core/Math.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+#include "../../Include/RmlUi/Core/RenderInterface.h"
+#include <algorithm>
+#include <string.h>
+
+namespace Rml {
+
+// Each packed texture is surrounded by a copy of its edge pixels, so that filtering never samples its neighbours.
+static constexpr int atlas_border = 1;
+
+TextureAtlasPage::TextureAtlasPage(RenderInterface* render_interface, TextureHandle handle, Vector2i dimensions) :
+	render_interface(render_interface), handle(handle), dimensions(dimensions)
+{}
+
+TextureAtlasPage::~TextureAtlasPage()
+{
+	if (handle)
+		render_interface->ReleaseTexture(handle);
+}
+
+TextureAtlas::TextureAtlas(int max_image_size, int page_size) :
+	max_image_size(max_image_size), page_size(Math::Max(page_size, max_image_size + 2 * atlas_border))
+{}
+
+TextureAtlas::~TextureAtlas()
+{}
+
+// Copies the source texture into the rectangle, extending its edges into the border.
+static void CopyWithBorder(TextureLayoutRectangle& rectangle, const byte* source, Vector2i source_dimensions)
+{
+	byte* destination = rectangle.GetTextureData();
+	const int stride = rectangle.GetTextureStride();
+	const Vector2i dimensions = rectangle.GetDimensions();
+
+	for (int y = 0; y < dimensions.y; y++)
+	{
+		const int source_y = Math::Clamp(y - atlas_border, 0, source_dimensions.y - 1);
+		const byte* source_row = source + source_y * source_dimensions.x * 4;
+		byte* destination_row = destination + y * stride;
+
+		memcpy(destination_row + atlas_border * 4, source_row, source_dimensions.x * 4);
+		for (int i = 0; i < atlas_border; i++)
+		{
+			memcpy(destination_row + i * 4, source_row, 4);
+			memcpy(destination_row + (atlas_border + source_dimensions.x + i) * 4, source_row + (source_dimensions.x - 1) * 4, 4);
+		}
+	}
+}
+
+bool TextureAtlas::Request(RenderInterface* render_interface, const SharedPtr<TextureResource>& texture, Vector2i& dimensions)
+{
+	for (const RequestedTexture& requested : requested_textures)
+	{
+		if (requested.render_interface == render_interface && requested.texture == texture)
+		{
+			dimensions = requested.dimensions;
+			return true;
+		}
+	}
+
+	RequestedTexture requested = { render_interface, texture, nullptr, Vector2i(0) };
+	if (!render_interface->LoadTextureData(requested.data, requested.dimensions, texture->GetSource()) || !requested.data)
+	{
+		texture->atlas_candidate = false;
+		return false;
+	}
+
+	dimensions = requested.dimensions;
+
+	if (dimensions.x > max_image_size || dimensions.y > max_image_size || dimensions.x <= 0 || dimensions.y <= 0)
+	{
+		// We already have the pixels, so generate the texture on its own right away.
+		texture->atlas_candidate = false;
+
+		TextureResource::TextureData& data = texture->texture_data[render_interface];
+		if (render_interface->GenerateTexture(data.handle, requested.data.get(), dimensions))
+		{
+			FrameStatisticsScope::Add(&FrameStatistics::num_textures_generated);
+			data.dimensions = dimensions;
+		}
+		else
+		{
+			Log::Message(Log::LT_WARNING, "Failed to generate texture from %s.", texture->GetSource().c_str());
+			data = TextureResource::TextureData();
+		}
+		return true;
+	}
+
+	requested_textures.push_back(std::move(requested));
+	return true;
+}
+
+void TextureAtlas::Pack(RenderInterface* render_interface)
+{
+	RMLUI_ZoneScoped;
+
+	Vector<RequestedTexture> packed_textures;
+	TextureLayout layout;
+
+	auto it_pack = std::stable_partition(requested_textures.begin(), requested_textures.end(),
+		[render_interface](const RequestedTexture& requested) { return requested.render_interface != render_interface; });
+
+	for (auto it = it_pack; it != requested_textures.end(); ++it)
+	{
+		// Skip textures which have been loaded by other means since they were requested.
+		if (it->texture->IsLoaded(render_interface))
+			continue;
+
+		layout.AddRectangle((int)packed_textures.size(), it->dimensions + Vector2i(2 * atlas_border));
+		packed_textures.push_back(std::move(*it));
+	}
+
+	requested_textures.erase(it_pack, requested_textures.end());
+
+	if (packed_textures.empty())
+		return;
+
+	if (!layout.GenerateLayout(page_size))
+	{
+		Log::Message(Log::LT_WARNING, "Failed to lay out texture atlas, the textures will be loaded individually.");
+		for (RequestedTexture& requested : packed_textures)
+			requested.texture->atlas_candidate = false;
+		return;
+	}
+
+	for (int page_index = 0; page_index < layout.GetNumTextures(); page_index++)
+	{
+		TextureLayoutTexture& layout_texture = layout.GetTexture(page_index);
+		const Vector2i page_dimensions = layout_texture.GetDimensions();
+
+		UniquePtr<byte[]> page_data = layout_texture.AllocateTexture();
+		if (!page_data)
+			continue;
+
+		for (int i = 0; i < layout.GetNumRectangles(); i++)
+		{
+			TextureLayoutRectangle& rectangle = layout.GetRectangle(i);
+			if (rectangle.GetTextureIndex() == page_index)
+			{
+				const RequestedTexture& requested = packed_textures[rectangle.GetId()];
+				CopyWithBorder(rectangle, requested.data.get(), requested.dimensions);
+			}
+		}
+
+		TextureHandle handle = 0;
+		if (!render_interface->GenerateTexture(handle, page_data.get(), page_dimensions))
+		{
+			Log::Message(Log::LT_WARNING, "Failed to generate texture atlas page, the textures will be loaded individually.");
+			for (int i = 0; i < layout.GetNumRectangles(); i++)
+			{
+				TextureLayoutRectangle& rectangle = layout.GetRectangle(i);
+				if (rectangle.GetTextureIndex() == page_index)
+					packed_textures[rectangle.GetId()].texture->atlas_candidate = false;
+			}
+			continue;
+		}
+
+		FrameStatisticsScope::Add(&FrameStatistics::num_textures_generated);
+		auto page = MakeShared<TextureAtlasPage>(render_interface, handle, page_dimensions);
+		const Vector2f page_size_f(page_dimensions);
+
+		for (int i = 0; i < layout.GetNumRectangles(); i++)
+		{
+			TextureLayoutRectangle& rectangle = layout.GetRectangle(i);
+			if (rectangle.GetTextureIndex() != page_index)
+				continue;
+
+			const RequestedTexture& requested = packed_textures[rectangle.GetId()];
+
+			TextureResource::TextureData& data = requested.texture->texture_data[render_interface];
+			data.handle = handle;
+			data.dimensions = requested.dimensions;
+			data.atlas_page = page;
+			data.atlas_texcoord_offset = Vector2f(rectangle.GetPosition() + Vector2i(atlas_border)) / page_size_f;
+			data.atlas_texcoord_scale = Vector2f(requested.dimensions) / page_size_f;
+		}
+	}
+}
+
+void TextureAtlas::ClearRequests(RenderInterface* render_interface)
+{
+	if (!render_interface)
+	{
+		requested_textures.clear();
+		return;
+	}
+
+	requested_textures.erase(std::remove_if(requested_textures.begin(), requested_textures.end(),
+								 [render_interface](const RequestedTexture& requested) { return requested.render_interface == render_interface; }),
+		requested_textures.end());
+}
+
+} // namespace Rml
@@ -0,0 +1,96 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_TEXTUREATLAS_H
+#define RMLUI_CORE_TEXTUREATLAS_H
+
+#include "../../Include/RmlUi/Core/Traits.h"
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+class RenderInterface;
+class TextureResource;
+
+/**
+	A texture shared by all the textures packed into it, released when the last of them is released.
+ */
+
+struct TextureAtlasPage : public NonCopyMoveable {
+	TextureAtlasPage(RenderInterface* render_interface, TextureHandle handle, Vector2i dimensions);
+	~TextureAtlasPage();
+
+	RenderInterface* render_interface;
+	TextureHandle handle;
+	Vector2i dimensions;
+};
+
+/**
+	The texture atlas packs small textures loaded from file into shared pages, so that geometry using different images
+	can be rendered with the same texture. The pages are laid out using the same texture layout as font textures.
+
+	Textures are requested when their dimensions or handle are first needed, and only the requested textures are packed
+	together once any of them is rendered. Texture coordinates are rewritten by the geometry, see TextureResource::GetAtlasRegion().
+ */
+
+class TextureAtlas {
+public:
+	/// @param[in] max_image_size The largest width or height of a texture to be packed.
+	/// @param[in] page_size The largest width or height of an atlas page, increased if needed to fit the largest texture.
+	TextureAtlas(int max_image_size, int page_size);
+	~TextureAtlas();
+
+	/// Loads the pixels of the given texture to be packed during the next call to Pack(). Textures too large to be packed
+	/// are generated on their own right away. Textures whose pixels could not be loaded are marked as not being atlas
+	/// candidates, and are left to be loaded normally.
+	/// @param[out] dimensions The dimensions of the texture.
+	/// @return True if the texture is waiting to be packed or has been generated, otherwise false.
+	bool Request(RenderInterface* render_interface, const SharedPtr<TextureResource>& texture, Vector2i& dimensions);
+
+	/// Packs all the textures requested for the render interface into new atlas pages.
+	void Pack(RenderInterface* render_interface);
+
+	/// Discards the requested textures waiting to be packed for the given render interface, or for all render interfaces if null.
+	void ClearRequests(RenderInterface* render_interface);
+
+private:
+	struct RequestedTexture {
+		RenderInterface* render_interface;
+		SharedPtr<TextureResource> texture;
+		UniquePtr<const byte[]> data;
+		Vector2i dimensions;
+	};
+
+	int max_image_size;
+	int page_size;
+
+	Vector<RequestedTexture> requested_textures;
+};
+
+} // namespace Rml
+#endif
@@ -27,10 +27,15 @@
  */
 
 #include "TextureDatabase.h"
+#include "TextureAtlas.h"
+#include "TextureLoader.h"
 #include "TextureResource.h"
 #include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/Math.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/StringUtilities.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
+#include <algorithm>
 
 namespace Rml {
 
@@ -126,10 +131,200 @@ StringList TextureDatabase::GetSourceList()
 	return result;
 }
 
+void TextureDatabase::SetAtlas(int max_image_size, int page_size)
+{
+	if (!texture_database)
+		return;
+
+	if (max_image_size > 0)
+		texture_database->atlas = MakeUnique<TextureAtlas>(max_image_size, page_size);
+	else
+		texture_database->atlas.reset();
+}
+
+bool TextureDatabase::RequestAtlasTexture(RenderInterface* render_interface, TextureResource* texture, Vector2i& dimensions)
+{
+	if (!texture_database || !texture_database->atlas)
+		return false;
+
+	auto it = texture_database->textures.find(texture->GetSource());
+	if (it == texture_database->textures.end() || it->second.get() != texture)
+		return false;
+
+	return texture_database->atlas->Request(render_interface, it->second, dimensions);
+}
+
+bool TextureDatabase::LoadAtlasTextures(RenderInterface* render_interface, TextureResource* texture)
+{
+	Vector2i dimensions;
+	if (!RequestAtlasTexture(render_interface, texture, dimensions))
+		return false;
+
+	texture_database->atlas->Pack(render_interface);
+	return true;
+}
+
+void TextureDatabase::SetAsyncLoading(const TextureDecoder& decoder, int max_uploads_per_frame, const TextureLoadedCallback& loaded_callback)
+{
+	if (!texture_database)
+		return;
+
+	// Textures still queued in a previous loader are loaded immediately instead.
+	texture_database->loader.reset();
+	for (const auto& texture : texture_database->textures)
+		texture.second->loading = false;
+
+	if (decoder)
+		texture_database->loader = MakeUnique<TextureLoader>(decoder, max_uploads_per_frame, loaded_callback);
+}
+
+bool TextureDatabase::LoadAsync(TextureResource* texture)
+{
+	if (!texture_database || !texture_database->loader)
+		return false;
+
+	auto it = texture_database->textures.find(texture->GetSource());
+	if (it == texture_database->textures.end() || it->second.get() != texture)
+		return false;
+
+	texture_database->loader->Enqueue(it->second);
+	return true;
+}
+
+int TextureDatabase::UploadLoadedTextures(RenderInterface* render_interface, Vector<ObserverPtr<Element>>& waiting_elements)
+{
+	if (!texture_database || !texture_database->loader)
+		return 0;
+
+	return texture_database->loader->Upload(render_interface, waiting_elements);
+}
+
+void TextureDatabase::AddWaitingElement(const Texture& texture, Element* element)
+{
+	if (texture.resource && texture.resource->loading)
+		texture.resource->AddWaitingElement(element);
+}
+
+void TextureDatabase::SetMemoryBudget(size_t memory_budget)
+{
+	if (texture_database)
+		texture_database->memory_budget = memory_budget;
+}
+
+unsigned int TextureDatabase::GetFrame()
+{
+	return texture_database ? texture_database->frame : 0;
+}
+
+void TextureDatabase::EvictTextures()
+{
+	if (!texture_database)
+		return;
+
+	TextureDatabase& database = *texture_database;
+	database.frame += 1;
+
+	if (database.memory_budget == 0)
+		return;
+
+	int num_textures = 0;
+	size_t memory_used = database.CalculateMemoryUsed(num_textures);
+	if (memory_used <= database.memory_budget)
+		return;
+
+	RMLUI_ZoneScoped;
+
+	// Textures used in the frame just rendered are kept, the frame number has already been advanced past it.
+	const unsigned int last_frame = database.frame - 1;
+
+	Vector<TextureResource*> candidates;
+	for (const auto& texture : database.textures)
+	{
+		if (texture.second.use_count() == 1 && !texture.second->loading && !texture.second->texture_data.empty())
+			candidates.push_back(texture.second.get());
+	}
+	for (TextureResource* texture : database.callback_textures)
+	{
+		if (texture->last_used_frame != last_frame && !texture->texture_data.empty())
+			candidates.push_back(texture);
+	}
+
+	std::stable_sort(candidates.begin(), candidates.end(), [](const TextureResource* a, const TextureResource* b) {
+		return a->last_used_frame < b->last_used_frame;
+	});
+
+	for (TextureResource* texture : candidates)
+	{
+		if (memory_used <= database.memory_budget)
+			break;
+
+		size_t memory_freed = texture->GetMemorySize();
+		for (const auto& interface_data_pair : texture->texture_data)
+		{
+			const SharedPtr<TextureAtlasPage>& page = interface_data_pair.second.atlas_page;
+			if (page && page.use_count() == 1)
+				memory_freed += 4 * size_t(page->dimensions.x) * size_t(page->dimensions.y);
+		}
+
+		// Generated textures are kept by their owner and generated again when needed, textures from file are removed.
+		if (texture->texture_callback)
+			texture->Release();
+		else
+			database.textures.erase(String(texture->GetSource()));
+
+		memory_used -= Math::Min(memory_freed, memory_used);
+		database.num_evicted += 1;
+	}
+}
+
+TextureStatistics TextureDatabase::GetStatistics()
+{
+	TextureStatistics statistics;
+	if (texture_database)
+	{
+		statistics.memory_budget = texture_database->memory_budget;
+		statistics.memory_used = texture_database->CalculateMemoryUsed(statistics.num_textures);
+		statistics.num_evicted = texture_database->num_evicted;
+	}
+	return statistics;
+}
+
+size_t TextureDatabase::CalculateMemoryUsed(int& num_textures) const
+{
+	size_t memory_used = 0;
+	SmallUnorderedSet<const TextureAtlasPage*> atlas_pages;
+
+	auto add_texture = [&](const TextureResource* texture) {
+		for (const auto& interface_data_pair : texture->texture_data)
+		{
+			const TextureResource::TextureData& data = interface_data_pair.second;
+			if (data.atlas_page)
+				atlas_pages.insert(data.atlas_page.get());
+			else if (data.handle)
+				num_textures += 1;
+		}
+		memory_used += texture->GetMemorySize();
+	};
+
+	for (const auto& texture : textures)
+		add_texture(texture.second.get());
+	for (const TextureResource* texture : callback_textures)
+		add_texture(texture);
+
+	for (const TextureAtlasPage* page : atlas_pages)
+		memory_used += 4 * size_t(page->dimensions.x) * size_t(page->dimensions.y);
+	num_textures += (int)atlas_pages.size();
+
+	return memory_used;
+}
+
 void TextureDatabase::ReleaseTextures(RenderInterface* render_interface)
 {
 	if (texture_database)
 	{
+		if (texture_database->atlas)
+			texture_database->atlas->ClearRequests(render_interface);
+
 		for (const auto& texture : texture_database->textures)
 			texture.second->Release(render_interface);
 
@@ -29,11 +29,15 @@
 #ifndef RMLUI_CORE_TEXTUREDATABASE_H
 #define RMLUI_CORE_TEXTUREDATABASE_H
 
+#include "../../Include/RmlUi/Core/Texture.h"
+#include "../../Include/RmlUi/Core/TextureStatistics.h"
 #include "../../Include/RmlUi/Core/Types.h"
 
 namespace Rml {
 
 class RenderInterface;
+class TextureAtlas;
+class TextureLoader;
 class TextureResource;
 
 /**
@@ -64,15 +68,58 @@ public:
 	/// Return a list of all texture sources currently in the database.
 	static StringList GetSourceList();
 
+	/// Enables packing of small textures loaded from file into atlas pages, or disables it if the maximum image size is zero.
+	static void SetAtlas(int max_image_size, int page_size);
+	/// Requests the texture to be packed into an atlas page, and loads its pixels to retrieve its dimensions.
+	/// @return True if the atlas is enabled and the dimensions are known, false if the texture should be loaded individually.
+	static bool RequestAtlasTexture(RenderInterface* render_interface, TextureResource* texture, Vector2i& dimensions);
+	/// Packs the texture together with all other textures requested for the render interface into atlas pages.
+	/// @return True if the atlas is enabled, false if the texture should be loaded individually.
+	static bool LoadAtlasTextures(RenderInterface* render_interface, TextureResource* texture);
+
+	/// Enables loading textures from file asynchronously, or disables it if the decoder is empty.
+	static void SetAsyncLoading(const TextureDecoder& decoder, int max_uploads_per_frame, const TextureLoadedCallback& loaded_callback);
+	/// Queues the texture to be loaded asynchronously.
+	/// @return True if asynchronous loading is enabled, false if the texture should be loaded immediately.
+	static bool LoadAsync(TextureResource* texture);
+	/// Uploads textures loaded asynchronously through the render interface, a limited number per call.
+	/// @param[out] waiting_elements The elements waiting for any of the textures that finished loading are appended here.
+	/// @return The number of textures that finished loading.
+	static int UploadLoadedTextures(RenderInterface* render_interface, Vector<ObserverPtr<Element>>& waiting_elements);
+	/// Registers the element to be notified when the texture has finished loading, if it is currently being loaded asynchronously.
+	static void AddWaitingElement(const Texture& texture, Element* element);
+
+	/// Sets the texture memory budget in bytes, or zero for no budget.
+	static void SetMemoryBudget(size_t memory_budget);
+	/// Returns the current frame, textures record the frame they were last used in.
+	static unsigned int GetFrame();
+	/// Evicts the least recently used textures until within the memory budget, then begins a new frame. Called once per
+	/// application frame, when a context is rendered a second time in the same frame. Textures loaded from file are only
+	/// evicted when no longer referenced, while generated textures such as font textures are released if they were not
+	/// used by any context in the current frame, and generated again when needed.
+	static void EvictTextures();
+	/// Returns the texture memory statistics.
+	static TextureStatistics GetStatistics();
+
 private:
 	TextureDatabase();
 	~TextureDatabase();
 
+	// Returns the estimated memory of all loaded textures, counting each atlas page once.
+	size_t CalculateMemoryUsed(int& num_textures) const;
+
 	using TextureMap = UnorderedMap< String, SharedPtr<TextureResource> >;
 	TextureMap textures;
 
     using CallbackTextureMap = UnorderedSet< TextureResource* >;
     CallbackTextureMap callback_textures;
+
+	UniquePtr<TextureAtlas> atlas;
+	UniquePtr<TextureLoader> loader;
+
+	size_t memory_budget = 0;
+	unsigned int frame = 1;
+	int num_evicted = 0;
 };
 
 } // namespace Rml
@@ -0,0 +1,155 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "TextureLoader.h"
+#include "FrameStatisticsScope.h"
+#include "TextureResource.h"
+#include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/FileInterface.h"
+#include "../../Include/RmlUi/Core/Log.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+#include "../../Include/RmlUi/Core/RenderInterface.h"
+
+namespace Rml {
+
+TextureLoader::TextureLoader(const TextureDecoder& decoder, int max_uploads_per_frame, const TextureLoadedCallback& loaded_callback) :
+	decoder(decoder), max_uploads_per_frame(max_uploads_per_frame), loaded_callback(loaded_callback)
+{
+	thread = std::thread([this] { ThreadLoop(); });
+}
+
+TextureLoader::~TextureLoader()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stop = true;
+	}
+	request_condition.notify_one();
+	thread.join();
+}
+
+void TextureLoader::Enqueue(const SharedPtr<TextureResource>& texture)
+{
+	texture->loading = true;
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		requests.push(Request{ texture, texture->GetSource() });
+	}
+	request_condition.notify_one();
+}
+
+int TextureLoader::Upload(RenderInterface* render_interface, Vector<ObserverPtr<Element>>& waiting_elements)
+{
+	RMLUI_ZoneScoped;
+
+	int num_uploaded = 0;
+
+	while (num_uploaded < max_uploads_per_frame)
+	{
+		Result result;
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			if (results.empty())
+				break;
+
+			result = std::move(results.front());
+			results.pop();
+		}
+
+		num_uploaded += 1;
+
+		SharedPtr<TextureResource> texture = result.texture.lock();
+		if (!texture || !texture->loading)
+			continue;
+
+		texture->loading = false;
+
+		for (ObserverPtr<Element>& element : texture->waiting_elements)
+			waiting_elements.push_back(std::move(element));
+		texture->waiting_elements.clear();
+
+		TextureResource::TextureData& data = texture->texture_data[render_interface];
+		data = TextureResource::TextureData();
+
+		if (result.success)
+		{
+			if (render_interface->GenerateTexture(data.handle, result.data.get(), result.dimensions))
+			{
+				FrameStatisticsScope::Add(&FrameStatistics::num_textures_generated);
+				data.dimensions = result.dimensions;
+			}
+			else
+				result.success = false;
+		}
+
+		if (!result.success)
+			Log::Message(Log::LT_WARNING, "Failed to load texture from %s.", result.source.c_str());
+
+		if (loaded_callback)
+			loaded_callback(result.source, result.success);
+	}
+
+	return num_uploaded;
+}
+
+void TextureLoader::ThreadLoop()
+{
+	while (true)
+	{
+		Request request;
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			request_condition.wait(lock, [this] { return stop || !requests.empty(); });
+			if (stop)
+				return;
+
+			request = std::move(requests.front());
+			requests.pop();
+		}
+
+		Result result = { std::move(request.texture), std::move(request.source), nullptr, Vector2i(0), false };
+
+		FileInterface* file_interface = GetFileInterface();
+		if (FileHandle handle = file_interface->Open(result.source))
+		{
+			const size_t file_size = file_interface->Length(handle);
+			UniquePtr<byte[]> file_data(new byte[file_size]);
+			const size_t read_size = file_interface->Read(file_data.get(), file_size, handle);
+			file_interface->Close(handle);
+
+			if (read_size == file_size)
+				result.success = decoder(result.source, file_data.get(), file_size, result.data, result.dimensions) && result.data;
+		}
+
+		std::lock_guard<std::mutex> lock(mutex);
+		results.push(std::move(result));
+	}
+}
+
+} // namespace Rml
@@ -0,0 +1,95 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_TEXTURELOADER_H
+#define RMLUI_CORE_TEXTURELOADER_H
+
+#include "../../Include/RmlUi/Core/Texture.h"
+#include "../../Include/RmlUi/Core/Traits.h"
+#include "../../Include/RmlUi/Core/Types.h"
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace Rml {
+
+class RenderInterface;
+class TextureResource;
+
+/**
+	The texture loader reads and decodes textures from file on a separate thread. The decoded textures are then
+	uploaded through the render interface on the render thread, a limited number per frame.
+
+	While a texture is loading it has no handle or dimensions, and geometry using it is not rendered.
+ */
+
+class TextureLoader : public NonCopyMoveable {
+public:
+	TextureLoader(const TextureDecoder& decoder, int max_uploads_per_frame, const TextureLoadedCallback& loaded_callback);
+	/// Stops the loader thread, any textures still in the queue are left unloaded.
+	~TextureLoader();
+
+	/// Queues the texture to be read and decoded on the loader thread.
+	void Enqueue(const SharedPtr<TextureResource>& texture);
+
+	/// Uploads decoded textures through the render interface, up to the number allowed per frame.
+	/// @param[out] waiting_elements The elements waiting for any of the uploaded textures are appended here.
+	/// @return The number of textures that finished loading, successfully or not.
+	int Upload(RenderInterface* render_interface, Vector<ObserverPtr<Element>>& waiting_elements);
+
+private:
+	void ThreadLoop();
+
+	struct Request {
+		WeakPtr<TextureResource> texture;
+		String source;
+	};
+	struct Result {
+		WeakPtr<TextureResource> texture;
+		String source;
+		UniquePtr<const byte[]> data;
+		Vector2i dimensions;
+		bool success;
+	};
+
+	const TextureDecoder decoder;
+	const int max_uploads_per_frame;
+	const TextureLoadedCallback loaded_callback;
+
+	std::thread thread;
+
+	// The queues are shared with the loader thread, and guarded by the mutex.
+	std::mutex mutex;
+	std::condition_variable request_condition;
+	Queue<Request> requests;
+	Queue<Result> results;
+	bool stop = false;
+};
+
+} // namespace Rml
+#endif
@@ -28,9 +28,12 @@
 
 #include "TextureResource.h"
 #include "TextureDatabase.h"
+#include "FrameStatisticsScope.h"
+#include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/Log.h"
 #include "../../Include/RmlUi/Core/RenderInterface.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
+#include <algorithm>
 
 namespace Rml {
 
@@ -47,6 +50,8 @@ void TextureResource::Set(const String& _source)
 {
 	Reset();
 	source = _source;
+	atlas_candidate = true;
+	loading = false;
 }
 
 void TextureResource::Set(const String& name, const TextureCallback& callback)
@@ -73,14 +78,18 @@ void TextureResource::Reset()
 // Returns the resource's underlying texture.
 TextureHandle TextureResource::GetHandle(RenderInterface* render_interface)
 {
+	last_used_frame = TextureDatabase::GetFrame();
+
 	auto texture_iterator = texture_data.find(render_interface);
 	if (texture_iterator == texture_data.end())
 	{
 		Load(render_interface);
 		texture_iterator = texture_data.find(render_interface);
+		if (texture_iterator == texture_data.end())
+			return 0;
 	}
 
-	return texture_iterator->second.first;
+	return texture_iterator->second.handle;
 }
 
 // Returns the dimensions of the resource's texture.
@@ -89,11 +98,18 @@ Vector2i TextureResource::GetDimensions(RenderInterface* render_interface)
 	auto texture_iterator = texture_data.find(render_interface);
 	if (texture_iterator == texture_data.end())
 	{
+		// Atlas candidates are only packed once their handle is needed, so that all textures requested until then share pages.
+		Vector2i dimensions;
+		if (IsAtlasCandidate() && TextureDatabase::RequestAtlasTexture(render_interface, this, dimensions))
+			return dimensions;
+
 		Load(render_interface);
 		texture_iterator = texture_data.find(render_interface);
+		if (texture_iterator == texture_data.end())
+			return Vector2i(0, 0);
 	}
 
-	return texture_iterator->second.second;
+	return texture_iterator->second.dimensions;
 }
 
 // Returns the resource's source.
@@ -109,8 +125,8 @@ void TextureResource::Release(RenderInterface* render_interface)
 	{
 		for (auto& interface_data_pair : texture_data)
 		{
-			TextureHandle handle = interface_data_pair.second.first;
-			if (handle)
+			TextureHandle handle = interface_data_pair.second.handle;
+			if (handle && !interface_data_pair.second.atlas_page)
 				interface_data_pair.first->ReleaseTexture(handle);
 		}
 
@@ -122,14 +138,59 @@ void TextureResource::Release(RenderInterface* render_interface)
 		if (texture_iterator == texture_data.end())
 			return;
 
-		TextureHandle handle = texture_iterator->second.first;
-		if (handle)
+		TextureHandle handle = texture_iterator->second.handle;
+		if (handle && !texture_iterator->second.atlas_page)
 			texture_iterator->first->ReleaseTexture(handle);
 
 		texture_data.erase(render_interface);
 	}
 }
 
+bool TextureResource::IsLoaded(RenderInterface* render_interface) const
+{
+	return texture_data.find(render_interface) != texture_data.end();
+}
+
+bool TextureResource::IsAtlasCandidate() const
+{
+	return atlas_candidate && !texture_callback && !loading;
+}
+
+bool TextureResource::IsLoading() const
+{
+	return loading;
+}
+
+void TextureResource::AddWaitingElement(Element* element)
+{
+	auto it = std::find_if(waiting_elements.begin(), waiting_elements.end(), [element](const ObserverPtr<Element>& ptr) { return ptr.get() == element; });
+	if (it == waiting_elements.end())
+		waiting_elements.push_back(element->GetObserverPtr());
+}
+
+size_t TextureResource::GetMemorySize() const
+{
+	size_t memory_size = 0;
+	for (const auto& interface_data_pair : texture_data)
+	{
+		const TextureData& data = interface_data_pair.second;
+		if (data.handle && !data.atlas_page)
+			memory_size += 4 * size_t(data.dimensions.x) * size_t(data.dimensions.y);
+	}
+	return memory_size;
+}
+
+bool TextureResource::GetAtlasRegion(RenderInterface* render_interface, Vector2f& texcoord_offset, Vector2f& texcoord_scale) const
+{
+	auto texture_iterator = texture_data.find(render_interface);
+	if (texture_iterator == texture_data.end() || !texture_iterator->second.atlas_page)
+		return false;
+
+	texcoord_offset = texture_iterator->second.atlas_texcoord_offset;
+	texcoord_scale = texture_iterator->second.atlas_texcoord_scale;
+	return true;
+}
+
 bool TextureResource::Load(RenderInterface* render_interface)
 {
 	RMLUI_ZoneScoped;
@@ -145,7 +206,7 @@ bool TextureResource::Load(RenderInterface* render_interface)
 		if (!callback_fnc(source, data, dimensions) || !data)
 		{
 			Log::Message(Log::LT_WARNING, "Failed to generate texture from callback function %s.", source.c_str());
-			texture_data[render_interface] = TextureData(0, Vector2i(0, 0));
+			texture_data[render_interface] = TextureData();
 
 			return false;
 		}
@@ -155,28 +216,38 @@ bool TextureResource::Load(RenderInterface* render_interface)
 
 		if (success)
 		{
+			FrameStatisticsScope::Add(&FrameStatistics::num_textures_generated);
 			texture_data[render_interface] = TextureData(handle, dimensions);
 		}
 		else
 		{
 			Log::Message(Log::LT_WARNING, "Failed to generate internal texture %s.", source.c_str());
-			texture_data[render_interface] = TextureData(0, Vector2i(0, 0));
+			texture_data[render_interface] = TextureData();
 		}
 
 		return success;
 	}
 
-	// No callback function, load the texture through the render interface.
+	// No callback function, try to pack the texture into an atlas together with any other requested textures.
+	if (atlas_candidate && TextureDatabase::LoadAtlasTextures(render_interface, this) && IsLoaded(render_interface))
+		return texture_data[render_interface].handle != 0;
+
+	// Otherwise, queue the texture to be loaded asynchronously if enabled. It will have no handle until it is uploaded.
+	if (loading || TextureDatabase::LoadAsync(this))
+		return false;
+
+	// Or load the texture through the render interface.
 	TextureHandle handle;
 	Vector2i dimensions;
 	if (!render_interface->LoadTexture(handle, dimensions, source))
 	{
 		Log::Message(Log::LT_WARNING, "Failed to load texture from %s.", source.c_str());
-		texture_data[render_interface] = TextureData(0, Vector2i(0, 0));
+		texture_data[render_interface] = TextureData();
 
 		return false;
 	}
 
+	FrameStatisticsScope::Add(&FrameStatistics::num_textures_generated);
 	texture_data[render_interface] = TextureData(handle, dimensions);
 	return true;
 }
@@ -34,6 +34,11 @@
 
 namespace Rml {
 
+class TextureAtlas;
+class TextureDatabase;
+class TextureLoader;
+struct TextureAtlasPage;
+
 /**
 	A texture resource stores application-generated texture data (handle and dimensions) for each
 	unique render interface that needs to render the data. It is used through a Texture object.
@@ -55,7 +60,7 @@ public:
 	/// Texture loading is delayed until the texture is accessed by a specific render interface.
 	void Set(const String& name, const TextureCallback& callback);
 
-	/// Returns the resource's underlying texture handle.
+	/// Returns the resource's underlying texture handle, and marks the texture as used in the current frame.
 	TextureHandle GetHandle(RenderInterface* render_interface);
 	/// Returns the dimensions of the resource's texture.
 	Vector2i GetDimensions(RenderInterface* render_interface);
@@ -66,6 +71,22 @@ public:
 	/// Releases the texture's handle.
 	void Release(RenderInterface* render_interface = nullptr);
 
+	/// Returns true if the texture has been loaded, or attempted to be loaded, for the given render interface.
+	bool IsLoaded(RenderInterface* render_interface) const;
+	/// Returns true if the texture may be packed into a texture atlas.
+	bool IsAtlasCandidate() const;
+	/// Returns true while the texture is being loaded asynchronously. Until then, it has no handle or dimensions.
+	bool IsLoading() const;
+	/// Adds an element to be notified once the texture has finished loading.
+	void AddWaitingElement(Element* element);
+
+	/// Returns the estimated memory of the textures loaded for all render interfaces, in bytes, excluding any atlas pages.
+	size_t GetMemorySize() const;
+
+	/// Returns the region of the texture's atlas page it is packed into, as an offset and scale to apply to texture coordinates.
+	/// @return True if the texture is packed into an atlas for the given render interface, otherwise false and the outputs are untouched.
+	bool GetAtlasRegion(RenderInterface* render_interface, Vector2f& texcoord_offset, Vector2f& texcoord_scale) const;
+
 private:
 	void Reset();
 
@@ -74,11 +95,37 @@ private:
 
 	String source;
 
-	using TextureData = Pair< TextureHandle, Vector2i >;
+	struct TextureData {
+		TextureData() = default;
+		TextureData(TextureHandle handle, Vector2i dimensions) : handle(handle), dimensions(dimensions) {}
+
+		TextureHandle handle = 0;
+		Vector2i dimensions;
+
+		// Set when the texture is packed into an atlas page, which then owns the handle.
+		SharedPtr<TextureAtlasPage> atlas_page;
+		Vector2f atlas_texcoord_offset;
+		Vector2f atlas_texcoord_scale;
+	};
 	using TextureDataMap = SmallUnorderedMap< RenderInterface*, TextureData >;
 	TextureDataMap texture_data;
 
 	UniquePtr<TextureCallback> texture_callback;
+
+	// Cleared once the texture is found not to fit in an atlas, so that it is loaded on its own.
+	bool atlas_candidate = true;
+
+	// Set while the texture is queued in the texture loader.
+	bool loading = false;
+	// The elements which used the texture while it was loading, to be notified when it is uploaded.
+	Vector<ObserverPtr<Element>> waiting_elements;
+
+	// The texture database frame in which the handle was last retrieved, used to evict the least recently used textures.
+	unsigned int last_used_frame = 0;
+
+	friend class Rml::TextureAtlas;
+	friend class Rml::TextureDatabase;
+	friend class Rml::TextureLoader;
 };
 
 } // namespace Rml
@@ -0,0 +1,133 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "WorkerPool.h"
+
+namespace Rml {
+
+WorkerPool::WorkerPool(int num_workers) : next_task(0)
+{
+	threads.reserve(num_workers);
+	for (int i = 0; i < num_workers; i++)
+		threads.emplace_back([this] { WorkerLoop(); });
+}
+
+WorkerPool::~WorkerPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stop = true;
+	}
+	work_condition.notify_all();
+
+	for (std::thread& thread : threads)
+		thread.join();
+}
+
+int WorkerPool::GetNumWorkers() const
+{
+	return (int)threads.size();
+}
+
+void WorkerPool::ParallelFor(int num_tasks, const Function<void(int)>& function)
+{
+	if (threads.empty() || num_tasks <= 1)
+	{
+		for (int i = 0; i < num_tasks; i++)
+			function(i);
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		batch_function = &function;
+		batch_num_tasks = num_tasks;
+		batch_num_completed = 0;
+		batch_counter += 1;
+		next_task = 0;
+	}
+	work_condition.notify_all();
+
+	const int num_completed = RunTasks(function, num_tasks);
+
+	std::unique_lock<std::mutex> lock(mutex);
+	batch_num_completed += num_completed;
+
+	// Close the batch once all tasks are done and no worker is still holding on to it.
+	done_condition.wait(lock, [this] { return batch_num_completed == batch_num_tasks && num_active_workers == 0; });
+	batch_function = nullptr;
+	batch_num_tasks = 0;
+}
+
+void WorkerPool::WorkerLoop()
+{
+	unsigned int last_batch = 0;
+
+	std::unique_lock<std::mutex> lock(mutex);
+	while (true)
+	{
+		work_condition.wait(lock, [&] { return stop || batch_counter != last_batch; });
+		if (stop)
+			return;
+
+		last_batch = batch_counter;
+
+		// The batch may already have been closed if we woke up late.
+		if (!batch_function)
+			continue;
+
+		const Function<void(int)>& function = *batch_function;
+		const int num_tasks = batch_num_tasks;
+		num_active_workers += 1;
+
+		lock.unlock();
+		const int num_completed = RunTasks(function, num_tasks);
+		lock.lock();
+
+		batch_num_completed += num_completed;
+		num_active_workers -= 1;
+		done_condition.notify_one();
+	}
+}
+
+int WorkerPool::RunTasks(const Function<void(int)>& function, int num_tasks)
+{
+	int num_completed = 0;
+	while (true)
+	{
+		const int task = next_task.fetch_add(1);
+		if (task >= num_tasks)
+			break;
+
+		function(task);
+		num_completed += 1;
+	}
+	return num_completed;
+}
+
+} // namespace Rml
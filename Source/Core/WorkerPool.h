@@ -0,0 +1,86 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_WORKERPOOL_H
+#define RMLUI_CORE_WORKERPOOL_H
+
+#include "../../Include/RmlUi/Core/Traits.h"
+#include "../../Include/RmlUi/Core/Types.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace Rml {
+
+/**
+	A fixed set of worker threads for splitting independent tasks between them.
+
+	The pool is driven by a single thread at a time, which also takes part in running the tasks.
+*/
+
+class WorkerPool : public NonCopyMoveable {
+public:
+	/// Starts the worker threads.
+	/// @param[in] num_workers The number of threads to start in addition to the calling thread.
+	WorkerPool(int num_workers);
+	/// Stops and joins the worker threads.
+	~WorkerPool();
+
+	/// Returns the number of worker threads.
+	int GetNumWorkers() const;
+
+	/// Calls the function once for every task index in [0, num_tasks), spread over the workers and the calling thread.
+	/// The calls may be made in any order and concurrently. Returns once all calls have completed.
+	void ParallelFor(int num_tasks, const Function<void(int)>& function);
+
+private:
+	void WorkerLoop();
+
+	// Runs tasks until none are left, returns the number of tasks run.
+	int RunTasks(const Function<void(int)>& function, int num_tasks);
+
+	Vector<std::thread> threads;
+
+	std::mutex mutex;
+	std::condition_variable work_condition;
+	std::condition_variable done_condition;
+
+	// The current batch of tasks, guarded by the mutex. The function is only set while the batch is open.
+	const Function<void(int)>* batch_function = nullptr;
+	int batch_num_tasks = 0;
+	int batch_num_completed = 0;
+	unsigned int batch_counter = 0;
+	int num_active_workers = 0;
+	bool stop = false;
+
+	std::atomic<int> next_task;
+};
+
+} // namespace Rml
+#endif
@@ -92,8 +92,7 @@ void ElementLottie::OnPropertyChange(const PropertyIdSet& changed_properties)
 {
 	Element::OnPropertyChange(changed_properties);
 
-	if (changed_properties.Contains(PropertyId::ImageColor) ||
-		changed_properties.Contains(PropertyId::Opacity)) {
+	if (changed_properties.Contains(PropertyId::ImageColor)) {
 		geometry_dirty = true;
 	}
 }
@@ -115,9 +114,7 @@ void ElementLottie::GenerateGeometry()
 
 	const ComputedValues& computed = GetComputedValues();
 
-	const float opacity = computed.opacity;
-	Colourb quad_colour = computed.image_color;
-	quad_colour.alpha = (byte)(opacity * (float)quad_colour.alpha);
+	const Colourb quad_colour = computed.image_color;
 
 	const Vector2f render_dimensions_f = GetBox().GetSize(Box::CONTENT).Round();
 	render_dimensions = Vector2i(render_dimensions_f);
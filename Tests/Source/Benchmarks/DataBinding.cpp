@@ -0,0 +1,263 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/DataModelHandle.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/Types.h>
+
+#include <doctest.h>
+#include <nanobench.h>
+#include <algorithm>
+
+using namespace ankerl;
+using namespace Rml;
+
+static const String document_rml = R"(
+<rml>
+<head>
+	<link type="text/template" href="/assets/window.rml"/>
+	<title>Data binding benchmark</title>
+	<style>
+		body.window
+		{
+			max-width: 2000px;
+			max-height: 2000px;
+			left: 100px;
+			top: 50px;
+			width: 1300px;
+			height: 600px;
+		}
+		.row { height: 20px; }
+		.danger { color: red; }
+	</style>
+</head>
+
+<body template="window">
+<div id="rows" data-model="rows">
+	<div class="row" data-for="row : rows" data-class-danger="row.stats.health < 20" data-event-click="selected = it_index">
+		<span data-style-width="row.stats.health + 'px'">{{ row.name | to_upper }}</span>
+		<span data-attr-title="row.name">{{ row.stats.health }} / {{ row.stats.max_health }}</span>
+		<span>{{ row.stats.health * 100 / row.stats.max_health | format(1) }}%</span>
+	</div>
+	<p>Selected: {{ selected }}</p>
+</div>
+</body>
+</rml>
+)";
+
+struct RowStats {
+	int health = 0;
+	int max_health = 100;
+};
+
+struct Row {
+	String name;
+	RowStats stats;
+};
+
+static Vector<Row> GenerateRows(int num_rows)
+{
+	static nanobench::Rng rng;
+
+	Vector<Row> rows(num_rows);
+	for (Row& row : rows)
+	{
+		row.name = CreateString(32, "Unit %d", int(rng() % 1000));
+		row.stats.health = int(rng() % 100);
+	}
+	return rows;
+}
+
+static int GetNumDescendentElements(Element* element)
+{
+	const int num_children = element->GetNumChildren(true);
+	int result = num_children;
+	for (int i = 0; i < num_children; i++)
+		result += GetNumDescendentElements(element->GetChild(i));
+	return result;
+}
+
+TEST_CASE("databinding")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	Vector<Row> rows;
+	int selected = -1;
+
+	DataModelConstructor constructor = context->CreateDataModel("rows");
+	REQUIRE(static_cast<bool>(constructor));
+
+	if (auto stats_handle = constructor.RegisterStruct<RowStats>())
+	{
+		stats_handle.RegisterMember("health", &RowStats::health);
+		stats_handle.RegisterMember("max_health", &RowStats::max_health);
+	}
+	if (auto row_handle = constructor.RegisterStruct<Row>())
+	{
+		row_handle.RegisterMember("name", &Row::name);
+		row_handle.RegisterMember("stats", &Row::stats);
+	}
+	constructor.RegisterArray<Vector<Row>>();
+	constructor.Bind("rows", &rows);
+	constructor.Bind("selected", &selected);
+
+	DataModelHandle handle = constructor.GetModelHandle();
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* rows_element = document->GetElementById("rows");
+	REQUIRE(rows_element);
+
+	constexpr int num_rows = 500;
+	const Vector<Row> initial_rows = GenerateRows(num_rows);
+	rows = initial_rows;
+	handle.DirtyVariable("rows");
+	context->Update();
+	context->Render();
+	TestsShell::RenderLoop();
+
+	const int num_elements = GetNumDescendentElements(rows_element);
+	MESSAGE(CreateString(128, "\nData binding with %d rows and %d total elements.\n", num_rows, num_elements));
+
+	nanobench::Bench bench;
+	bench.title("Data binding");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	bench.run("Update (unmodified)", [&] {
+		context->Update();
+	});
+
+	bench.run("Update (dirty, unchanged)", [&] {
+		handle.DirtyVariable("rows");
+		context->Update();
+	});
+
+	// Report the following per row, the costs per view and per element are measured separately below.
+	bench.batch(num_rows).unit("row");
+
+	int counter = 0;
+	bench.run("Scalar update, all rows", [&] {
+		counter += 1;
+		for (Row& row : rows)
+			row.stats.health = (row.stats.health + counter) % 100;
+		handle.DirtyVariable("rows");
+		context->Update();
+	});
+
+	bench.run("Nested struct update, all rows", [&] {
+		counter += 1;
+		for (Row& row : rows)
+			row.stats.max_health = 100 + counter % 2;
+		handle.DirtyVariable("rows");
+		context->Update();
+	});
+
+	bench.run("Transform function update, all rows", [&] {
+		counter += 1;
+		for (Row& row : rows)
+			row.name = (counter % 2 ? "Unit" : "Soldier");
+		handle.DirtyVariable("rows");
+		context->Update();
+	});
+
+	bench.run("Reorder", [&] {
+		std::reverse(rows.begin(), rows.end());
+		handle.DirtyVariable("rows");
+		context->Update();
+	});
+
+	bench.run("Remove and add rows", [&] {
+		rows.clear();
+		handle.DirtyVariable("rows");
+		context->Update();
+
+		rows = initial_rows;
+		handle.DirtyVariable("rows");
+		context->Update();
+	});
+
+	bench.run("Update + Render (scalar update)", [&] {
+		counter += 1;
+		for (Row& row : rows)
+			row.stats.health = (row.stats.health + counter) % 100;
+		handle.DirtyVariable("rows");
+		context->Update();
+		context->Render();
+	});
+
+	// Separate the cost of evaluating each view from the cost of applying a changed result to its element. All the views
+	// are evaluated in both of the following, while only the latter changes the width and the two numeric texts of each row.
+	constexpr int num_views_per_row = 6;
+	constexpr int num_changed_elements_per_row = 3;
+	const int num_views = num_rows * num_views_per_row + 1;
+	const int num_changed_elements = num_rows * num_changed_elements_per_row;
+
+	for (Row& row : rows)
+		row.stats.health = 50;
+	handle.DirtyVariable("rows");
+	context->Update();
+
+	bench.batch(num_views).unit("view");
+	bench.run("Views evaluated, output unchanged", [&] {
+		handle.DirtyVariable("rows");
+		context->Update();
+	});
+	const double time_views = bench.results().back().median(nanobench::Result::Measure::elapsed);
+
+	bench.batch(num_changed_elements).unit("element");
+	bench.run("Views evaluated, output changed", [&] {
+		counter += 1;
+		for (Row& row : rows)
+			row.stats.health = 50 + counter % 2;
+		handle.DirtyVariable("rows");
+		context->Update();
+	});
+	const double time_elements = bench.results().back().median(nanobench::Result::Measure::elapsed) - time_views;
+
+	MESSAGE(CreateString(256, "\nCost per view: %.3f us. Cost per changed element, excluding its view: %.3f us.\n",
+		1.0e6 * time_views / double(num_views), 1.0e6 * time_elements / double(num_changed_elements)));
+
+	bench.batch(1).unit("event");
+
+	Element* first_row = rows_element->GetFirstChild();
+	REQUIRE(first_row);
+	bench.run("Controller event", [&] {
+		first_row->Click();
+		context->Update();
+	});
+
+	document->Close();
+	context->Update();
+	context->RemoveDataModel("rows");
+}
@@ -53,6 +53,19 @@ bool TestsSystemInterface::LogMessage(Rml::Log::Type type, const Rml::String& me
 	return result;
 }
 
+double TestsSystemInterface::GetElapsedTime()
+{
+	if (elapsed_time >= 0.0)
+		return elapsed_time;
+
+	return ShellSystemInterface::GetElapsedTime();
+}
+
+void TestsSystemInterface::SetElapsedTime(double in_elapsed_time)
+{
+	elapsed_time = in_elapsed_time;
+}
+
 void TestsSystemInterface::SetNumExpectedWarnings(int in_num_expected_warnings)
 {
 	if (num_expected_warnings > 0)
@@ -72,34 +85,109 @@ void TestsSystemInterface::SetNumExpectedWarnings(int in_num_expected_warnings)
 	num_expected_warnings = in_num_expected_warnings;
 }
 
-void TestsRenderInterface::RenderGeometry(Rml::Vertex* /*vertices*/, int /*num_vertices*/, int* /*indices*/, int /*num_indices*/, const Rml::TextureHandle /*texture*/, const Rml::Vector2f& /*translation*/)
+TestsRenderInterface::TestsRenderInterface(const Options& options) : options(options)
+{}
+
+void TestsRenderInterface::RenderGeometry(Rml::Vertex* vertices, int num_vertices, int* indices, int num_indices, const Rml::TextureHandle texture, const Rml::Vector2f& translation)
 {
 	counters.render_calls += 1;
+
+	if (options.record_geometry)
+	{
+		RenderedGeometry geometry;
+		geometry.vertices.assign(vertices, vertices + num_vertices);
+		geometry.indices.assign(indices, indices + num_indices);
+		geometry.texture = texture;
+		geometry.translation = translation;
+		Record(std::move(geometry));
+	}
 }
 
-void TestsRenderInterface::EnableScissorRegion(bool /*enable*/)
+Rml::CompiledGeometryHandle TestsRenderInterface::CompileGeometry(Rml::Vertex* vertices, int num_vertices, int* indices, int num_indices, Rml::TextureHandle texture)
+{
+	if (!options.compile_geometry)
+		return 0;
+
+	counters.compile_geometry += 1;
+
+	RenderedGeometry geometry;
+	if (options.record_geometry)
+	{
+		geometry.vertices.assign(vertices, vertices + num_vertices);
+		geometry.indices.assign(indices, indices + num_indices);
+	}
+	geometry.texture = texture;
+
+	last_compiled_geometry_handle += 1;
+	compiled_geometry.emplace(last_compiled_geometry_handle, std::move(geometry));
+	return last_compiled_geometry_handle;
+}
+
+void TestsRenderInterface::RenderCompiledGeometry(Rml::CompiledGeometryHandle handle, const Rml::Vector2f& translation)
+{
+	counters.render_calls += 1;
+
+	auto it = compiled_geometry.find(handle);
+	if (it == compiled_geometry.end())
+	{
+		FAIL_CHECK("Rendering released or unknown compiled geometry.");
+		return;
+	}
+
+	if (options.record_geometry)
+	{
+		RenderedGeometry geometry = it->second;
+		geometry.translation = translation;
+		Record(std::move(geometry));
+	}
+}
+
+void TestsRenderInterface::ReleaseCompiledGeometry(Rml::CompiledGeometryHandle handle)
+{
+	counters.release_compiled_geometry += 1;
+	CHECK(compiled_geometry.erase(handle) == 1);
+}
+
+void TestsRenderInterface::EnableScissorRegion(bool enable)
 {
 	counters.enable_scissor += 1;
+	scissor_enabled = enable;
 }
 
-void TestsRenderInterface::SetScissorRegion(int /*x*/, int /*y*/, int /*width*/, int /*height*/)
+void TestsRenderInterface::SetScissorRegion(int x, int y, int width, int height)
 {
 	counters.set_scissor += 1;
+	scissor_region = Rml::Vector4i(x, y, width, height);
 }
 
 bool TestsRenderInterface::LoadTexture(Rml::TextureHandle& texture_handle, Rml::Vector2i& texture_dimensions, const Rml::String& /*source*/)
 {
 	counters.load_texture += 1;
-	texture_handle = 1;
-	texture_dimensions.x = 512;
-	texture_dimensions.y = 256;
+
+	if (options.texture_dimensions.x <= 0 || options.texture_dimensions.y <= 0)
+		return false;
+
+	texture_handle = ++last_texture_handle;
+	texture_dimensions = options.texture_dimensions;
 	return true;
 }
 
-bool TestsRenderInterface::GenerateTexture(Rml::TextureHandle& texture_handle, const Rml::byte* /*source*/, const Rml::Vector2i& /*source_dimensions*/)
+bool TestsRenderInterface::LoadTextureData(Rml::UniquePtr<const Rml::byte[]>& data, Rml::Vector2i& dimensions, const Rml::String& source)
+{
+	if (options.load_texture_data)
+		return options.load_texture_data(data, dimensions, source);
+
+	return Rml::RenderInterface::LoadTextureData(data, dimensions, source);
+}
+
+bool TestsRenderInterface::GenerateTexture(Rml::TextureHandle& texture_handle, const Rml::byte* /*source*/, const Rml::Vector2i& source_dimensions)
 {
 	counters.generate_texture += 1;
-	texture_handle = 1;
+	texture_handle = ++last_texture_handle;
+
+	if (options.record_geometry)
+		recording.generated_texture_dimensions.push_back(source_dimensions);
+
 	return true;
 }
 
@@ -112,3 +200,65 @@ void TestsRenderInterface::SetTransform(const Rml::Matrix4f* /*transform*/)
 {
 	counters.set_transform += 1;
 }
+
+bool TestsRenderInterface::SetOpacity(float new_opacity)
+{
+	counters.set_opacity += 1;
+	opacity = new_opacity;
+	return options.apply_opacity;
+}
+
+bool TestsRenderInterface::BeginRenderToTexture(const Rml::Vector2i& /*origin*/, const Rml::Vector2i& dimensions)
+{
+	if (!options.render_to_texture)
+		return false;
+
+	counters.render_to_texture += 1;
+
+	if (options.record_geometry)
+		recording.render_to_texture_dimensions.push_back(dimensions);
+
+	return true;
+}
+
+Rml::TextureHandle TestsRenderInterface::EndRenderToTexture()
+{
+	return ++last_texture_handle;
+}
+
+Rml::SmallUnorderedSet<Rml::TextureHandle> TestsRenderInterface::GetRenderedTextures() const
+{
+	Rml::SmallUnorderedSet<Rml::TextureHandle> textures;
+	for (const RenderedGeometry& geometry : recording.geometry)
+	{
+		if (geometry.texture)
+			textures.insert(geometry.texture);
+	}
+	return textures;
+}
+
+int TestsRenderInterface::GetNumRenderedVertices() const
+{
+	int num_vertices = 0;
+	for (const RenderedGeometry& geometry : recording.geometry)
+		num_vertices += (int)geometry.vertices.size();
+	return num_vertices;
+}
+
+Rml::Vector2f TestsRenderInterface::GetRenderedPositionSum() const
+{
+	Rml::Vector2f sum(0.f);
+	for (const RenderedGeometry& geometry : recording.geometry)
+	{
+		for (int index : geometry.indices)
+			sum += geometry.vertices[index].position + geometry.translation;
+	}
+	return sum;
+}
+
+void TestsRenderInterface::Record(RenderedGeometry&& geometry)
+{
+	geometry.scissor_region = (scissor_enabled ? scissor_region : Rml::Vector4i(-1));
+	geometry.opacity = opacity;
+	recording.geometry.push_back(std::move(geometry));
+}
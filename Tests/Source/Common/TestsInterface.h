@@ -38,11 +38,18 @@ class TestsSystemInterface : public ShellSystemInterface
 public:
 	bool LogMessage(Rml::Log::Type type, const Rml::String& message) override;
 
+	double GetElapsedTime() override;
+
 	// Checks and clears previously logged messages, then sets the number of expected
 	// warnings and errors until the next call.
 	void SetNumExpectedWarnings(int num_expected_warnings);
 
+	// Sets the elapsed time reported to RmlUi in seconds, or a negative value to use the real clock.
+	void SetElapsedTime(double elapsed_time);
+
 private:
+	double elapsed_time = -1.0;
+
 	int num_logged_warnings = 0;
 	int num_expected_warnings = 0;
 
@@ -61,19 +68,70 @@ public:
 		size_t generate_texture;
 		size_t release_texture;
 		size_t set_transform;
+		size_t set_opacity;
+		size_t compile_geometry;
+		size_t release_compiled_geometry;
+		size_t render_to_texture;
+	};
+
+	// Optional behavior and recording, all disabled by default so that the renderer only collects statistics.
+	struct Options {
+		// Records the geometry of every render call, see GetRecording().
+		bool record_geometry = false;
+		// Supports compiled geometry, and renders it as any other geometry.
+		bool compile_geometry = false;
+		// Supports rendering into textures, see RenderInterface::BeginRenderToTexture().
+		bool render_to_texture = false;
+		// Applies the opacity in the renderer instead of letting RmlUi apply it to the vertex colours.
+		bool apply_opacity = false;
+		// The dimensions of all textures loaded from file, or zero to fail loading them.
+		Rml::Vector2i texture_dimensions = Rml::Vector2i(512, 256);
+		// Provides the pixels of textures from file if set, see RenderInterface::LoadTextureData().
+		Rml::Function<bool(Rml::UniquePtr<const Rml::byte[]>& data, Rml::Vector2i& dimensions, const Rml::String& source)> load_texture_data;
+	};
+
+	// A single call to render geometry, either directly or compiled.
+	struct RenderedGeometry {
+		Rml::Vector<Rml::Vertex> vertices;
+		Rml::Vector<int> indices;
+		Rml::TextureHandle texture = 0;
+		Rml::Vector2f translation;
+		// The scissor region as (x, y, width, height), or -1 in all components while scissoring is disabled.
+		Rml::Vector4i scissor_region;
+		// The opacity set while rendering, only applicable when the renderer applies the opacity.
+		float opacity = 1.f;
+	};
+
+	struct Recording {
+		Rml::Vector<RenderedGeometry> geometry;
+		Rml::Vector<Rml::Vector2i> generated_texture_dimensions;
+		Rml::Vector<Rml::Vector2i> render_to_texture_dimensions;
 	};
 
+	TestsRenderInterface() = default;
+	explicit TestsRenderInterface(const Options& options);
+
 	void RenderGeometry(Rml::Vertex* vertices, int num_vertices, int* indices, int num_indices, Rml::TextureHandle texture, const Rml::Vector2f& translation) override;
 
+	Rml::CompiledGeometryHandle CompileGeometry(Rml::Vertex* vertices, int num_vertices, int* indices, int num_indices, Rml::TextureHandle texture) override;
+	void RenderCompiledGeometry(Rml::CompiledGeometryHandle geometry, const Rml::Vector2f& translation) override;
+	void ReleaseCompiledGeometry(Rml::CompiledGeometryHandle geometry) override;
+
 	void EnableScissorRegion(bool enable) override;
 	void SetScissorRegion(int x, int y, int width, int height) override;
 
 	bool LoadTexture(Rml::TextureHandle& texture_handle, Rml::Vector2i& texture_dimensions, const Rml::String& source) override;
+	bool LoadTextureData(Rml::UniquePtr<const Rml::byte[]>& data, Rml::Vector2i& dimensions, const Rml::String& source) override;
 	bool GenerateTexture(Rml::TextureHandle& texture_handle, const Rml::byte* source, const Rml::Vector2i& source_dimensions) override;
 	void ReleaseTexture(Rml::TextureHandle texture_handle) override;
 
 	void SetTransform(const Rml::Matrix4f* transform) override;
 
+	bool SetOpacity(float opacity) override;
+
+	bool BeginRenderToTexture(const Rml::Vector2i& origin, const Rml::Vector2i& dimensions) override;
+	Rml::TextureHandle EndRenderToTexture() override;
+
 	const Counters& GetCounters() const {
 		return counters;
 	}
@@ -82,7 +140,41 @@ public:
 		counters = {};
 	}
 
+	const Recording& GetRecording() const {
+		return recording;
+	}
+
+	void ResetRecording() {
+		recording = {};
+	}
+
+	// Returns the non-zero textures of the recorded geometry.
+	Rml::SmallUnorderedSet<Rml::TextureHandle> GetRenderedTextures() const;
+	// Returns the total number of vertices in the recorded geometry.
+	int GetNumRenderedVertices() const;
+	// Returns the sum of the translated vertex positions of each recorded index, to compare rendered geometry.
+	Rml::Vector2f GetRenderedPositionSum() const;
+
+	// Returns the opacity last set by RmlUi.
+	float GetOpacity() const {
+		return opacity;
+	}
+
 private:
+	void Record(RenderedGeometry&& geometry);
+
+	Options options;
+
 	Counters counters = {};
+	Recording recording;
+
+	// Every texture and compiled geometry is given a unique handle.
+	Rml::TextureHandle last_texture_handle = 0;
+	Rml::UnorderedMap<Rml::CompiledGeometryHandle, RenderedGeometry> compiled_geometry;
+	Rml::CompiledGeometryHandle last_compiled_geometry_handle = 0;
+
+	bool scissor_enabled = false;
+	Rml::Vector4i scissor_region = Rml::Vector4i(0);
+	float opacity = 1.f;
 };
 #endif
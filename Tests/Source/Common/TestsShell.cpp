@@ -119,6 +119,23 @@ Rml::Context* TestsShell::GetContext()
 	return shell_context;
 }
 
+Rml::Context* TestsShell::CreateContext(const Rml::String& name, Rml::Vector2i dimensions, Rml::RenderInterface* render_interface)
+{
+	InitializeShell();
+
+	Rml::Context* context = Rml::CreateContext(name, dimensions, render_interface);
+	REQUIRE(context);
+	return context;
+}
+
+void TestsShell::RemoveContext(Rml::Context* context)
+{
+	REQUIRE(context);
+	REQUIRE(context != shell_context);
+	const Rml::String name = context->GetName();
+	CHECK(Rml::RemoveContext(name));
+}
+
 void TestsShell::PrepareRenderBuffer()
 {
 #ifdef RMLUI_TESTS_USE_SHELL
@@ -158,6 +175,8 @@ void TestsShell::ShutdownShell()
 
 		Rml::Shutdown();
 
+		tests_system_interface.SetElapsedTime(-1.0);
+
 #ifdef RMLUI_TESTS_USE_SHELL
 		Shell::CloseWindow();
 		Shell::Shutdown();
@@ -173,6 +192,11 @@ void TestsShell::SetNumExpectedWarnings(int num_warnings)
 	tests_system_interface.SetNumExpectedWarnings(num_warnings);
 }
 
+void TestsShell::SetElapsedTime(double elapsed_time)
+{
+	tests_system_interface.SetElapsedTime(elapsed_time);
+}
+
 Rml::String TestsShell::GetRenderStats()
 {
 	Rml::String result;
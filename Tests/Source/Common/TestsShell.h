@@ -37,6 +37,11 @@ namespace TestsShell {
 	// Will initialize the shell and create a context on first use.
 	Rml::Context* GetContext();
 
+	// Initializes the shell if needed, and creates an additional context rendering through the given render interface.
+	Rml::Context* CreateContext(const Rml::String& name, Rml::Vector2i dimensions, Rml::RenderInterface* render_interface);
+	// Removes a context created with 'CreateContext()'.
+	void RemoveContext(Rml::Context* context);
+
 	void PrepareRenderBuffer();
 	void PresentRenderBuffer();
 
@@ -51,6 +56,10 @@ namespace TestsShell {
 	// or until 'ShutdownShell()'.
 	void SetNumExpectedWarnings(int num_warnings);
 
+	// Set the elapsed time reported to RmlUi in seconds, such as for advancing animations in controlled steps. Applies
+	// until the next call to this function or until 'ShutdownShell()', a negative value uses the real clock again.
+	void SetElapsedTime(double elapsed_time);
+
 	// Stats only available for the dummy renderer.
 	Rml::String GetRenderStats();
 }
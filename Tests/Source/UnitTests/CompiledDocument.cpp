@@ -0,0 +1,181 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../../../Source/Core/CompiledDocument.h"
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Core.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/StreamMemory.h>
+#include <doctest.h>
+
+using namespace Rml;
+
+static const String document_compiled_rml = R"(
+<rml>
+<head>
+	<title>Compiled &amp; loaded</title>
+	<link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		body { width: 400px; height: 300px; }
+		#header { height: 20px; }
+	</style>
+	<script><![CDATA[ if (a < b) {} ]]></script>
+</head>
+
+<body>
+<!-- A comment. -->
+<div id="header" class="a b" title="x &lt; y">Header</div>
+<p>Some <em>emphasized</em> text<br/>and a line break.</p>
+</body>
+</rml>
+)";
+
+static String CompileFromMemory(const String& rml)
+{
+	StreamMemory stream((const byte*)rml.data(), rml.size());
+	stream.SetSourceURL("compiled_document.rml");
+
+	CompiledDocumentWriter writer;
+	return writer.Compile(&stream);
+}
+
+TEST_CASE("compiled_document")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	SUBCASE("equivalent")
+	{
+		const String compiled_rml = CompileFromMemory(document_compiled_rml);
+		CHECK(CompiledDocumentReader::IsCompiledDocument(compiled_rml));
+		CHECK(!CompiledDocumentReader::IsCompiledDocument(document_compiled_rml));
+
+		ElementDocument* document = context->LoadDocumentFromMemory(document_compiled_rml, "compiled_document.rml");
+		ElementDocument* compiled_document = context->LoadDocumentFromMemory(compiled_rml, "compiled_document.rml");
+		REQUIRE(document);
+		REQUIRE(compiled_document);
+
+		document->Show();
+		compiled_document->Show();
+		context->Update();
+
+		CHECK(compiled_document->GetTitle() == document->GetTitle());
+		CHECK(compiled_document->GetInnerRML() == document->GetInnerRML());
+		CHECK(compiled_document->GetNumChildren() == document->GetNumChildren());
+
+		// The style sheets are applied the same way.
+		CHECK(compiled_document->GetBox().GetSize() == document->GetBox().GetSize());
+		CHECK(compiled_document->GetElementById("header")->GetBox().GetSize() == document->GetElementById("header")->GetBox().GetSize());
+
+		document->Close();
+		compiled_document->Close();
+	}
+
+	SUBCASE("from_file")
+	{
+		const String document_path = "basic/benchmark/data/benchmark.rml";
+
+		String compiled_rml;
+		REQUIRE(Rml::CompileDocument(document_path, compiled_rml));
+
+		// Templates and style sheets are still found relative to the source path.
+		ElementDocument* document = context->LoadDocument(document_path);
+		ElementDocument* compiled_document = context->LoadDocumentFromMemory(compiled_rml, document_path);
+		REQUIRE(document);
+		REQUIRE(compiled_document);
+
+		context->Update();
+
+		CHECK(compiled_document->GetTitle() == "Benchmark Sample");
+		CHECK(compiled_document->GetInnerRML() == document->GetInnerRML());
+		CHECK(compiled_document->GetElementById("performance") != nullptr);
+
+		document->Close();
+		compiled_document->Close();
+	}
+
+	SUBCASE("invalid")
+	{
+		const String compiled_rml = CompileFromMemory(document_compiled_rml);
+
+		auto write_integer = [](String& output, uint32_t value) {
+			for (int i = 0; i < 4; i++)
+				output += (char)((value >> (8 * i)) & 0xff);
+		};
+
+		// Signature and version of a compiled document, followed by an oversized string count.
+		String oversized_num_strings = compiled_rml.substr(0, 8);
+		write_integer(oversized_num_strings, 0xffffffff);
+
+		// A single string with an oversized length.
+		String oversized_string_length = compiled_rml.substr(0, 8);
+		write_integer(oversized_string_length, 1);
+		write_integer(oversized_string_length, 0xfffffff0);
+		oversized_string_length += "rml";
+
+		// A single element with an oversized attribute count.
+		String oversized_num_attributes = compiled_rml.substr(0, 8);
+		write_integer(oversized_num_attributes, 1);
+		write_integer(oversized_num_attributes, 3);
+		oversized_num_attributes += "rml";
+		write_integer(oversized_num_attributes, 1);
+		oversized_num_attributes += (char)CompiledDocumentReader::NodeType::ElementStart;
+		write_integer(oversized_num_attributes, 1);
+		write_integer(oversized_num_attributes, 0);
+		write_integer(oversized_num_attributes, 0xffffffff);
+
+		const String invalid_documents[] = {
+			compiled_rml.substr(0, compiled_rml.size() / 2),
+			compiled_rml.substr(0, 6),
+			compiled_rml.substr(0, compiled_rml.size() - 1),
+			oversized_num_strings,
+			oversized_string_length,
+			oversized_num_attributes,
+		};
+
+		for (const String& invalid_document : invalid_documents)
+		{
+			CHECK(CompiledDocumentReader::IsCompiledDocument(invalid_document));
+
+			TestsShell::SetNumExpectedWarnings(1);
+
+			ElementDocument* document = context->LoadDocumentFromMemory(invalid_document, "compiled_document.rml");
+			CHECK(!document);
+
+			TestsShell::SetNumExpectedWarnings(0);
+
+			if (document)
+				document->Close();
+		}
+	}
+
+	context->Update();
+	TestsShell::ShutdownShell();
+}
@@ -122,3 +122,60 @@ TEST_CASE("core.texture_source_list")
 
 	TestsShell::ShutdownShell();
 }
+
+TEST_CASE("core.frame_statistics")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_textures_rml);
+	REQUIRE(document);
+	document->Show();
+
+	// The document is already laid out when loaded, make sure it is laid out again within the measured frame.
+	document->SetProperty(PropertyId::PaddingTop, Property(5.f, Property::PX));
+
+	context->Update();
+	context->Render();
+
+	const FrameStatistics first = context->GetFrameStatistics();
+	CHECK(first.num_elements_updated > 0);
+	CHECK(first.num_definitions_resolved > 0);
+	CHECK(first.num_properties_computed > 0);
+	CHECK(first.num_layouts > 0);
+	CHECK(first.layout_documents.size() == (size_t)first.num_layouts);
+	CHECK(std::find(first.layout_documents.begin(), first.layout_documents.end(), document->GetSourceURL()) != first.layout_documents.end());
+	CHECK(first.num_geometry_generated > 0);
+	CHECK(first.num_draw_calls > 0);
+	CHECK(first.num_vertices >= 4 * first.num_draw_calls);
+	CHECK(first.num_textures_generated > 0);
+
+	// Nothing changed, the statistics should reflect the work skipped on the second frame.
+	context->Update();
+	context->Render();
+
+	const FrameStatistics& second = context->GetFrameStatistics();
+	CHECK(second.num_elements_updated < first.num_elements_updated);
+	CHECK(second.num_definitions_resolved == 0);
+	CHECK(second.num_properties_computed == 0);
+	CHECK(second.num_layouts == 0);
+	CHECK(second.layout_documents.empty());
+	CHECK(second.num_geometry_generated == 0);
+	CHECK(second.num_draw_calls == first.num_draw_calls);
+	CHECK(second.num_vertices == first.num_vertices);
+	CHECK(second.num_textures_generated == 0);
+
+	// Changing the layout of the document should only lay out this document.
+	document->SetProperty(PropertyId::PaddingTop, Property(10.f, Property::PX));
+	context->Update();
+	context->Render();
+
+	const FrameStatistics& third = context->GetFrameStatistics();
+	CHECK(third.num_layouts == 1);
+	CHECK(third.layout_documents == StringList{ document->GetSourceURL() });
+	CHECK(third.num_properties_computed > 0);
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
@@ -27,9 +27,17 @@
  */
 
 #include "../../../Source/Core/DataModel.cpp"
-#include <RmlUi/Core/Types.h>
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/DataModelHandle.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/ElementInstancer.h>
+#include <RmlUi/Core/ElementText.h>
+#include <RmlUi/Core/Factory.h>
+#include <RmlUi/Core/PropertyIdSet.h>
+#include <RmlUi/Core/Types.h>
 #include <doctest.h>
+#include <thread>
 
 using namespace Rml;
 
@@ -116,3 +124,268 @@ TEST_CASE("Data variables")
 		CHECK(get_result.Get<String>() == "90");
 	}
 }
+
+TEST_CASE("Data model change detection")
+{
+	DataModel model;
+	DataTypeRegister types;
+
+	DataModelConstructor handle(&model, &types);
+
+	int counter = 0;
+	String title = "first";
+	Vector<int> list = { 1, 2, 3 };
+
+	handle.RegisterArray<Vector<int>>();
+	handle.Bind("counter", &counter);
+	handle.SetChangeDetection(true);
+	handle.Bind("title", &title);
+	handle.Bind("list", &list);
+
+	model.Update(false);
+	CHECK(!model.IsVariableDirty("counter"));
+	CHECK(!model.IsVariableDirty("title"));
+
+	counter = 5;
+	model.Update(false);
+	CHECK(model.IsVariableDirty("counter"));
+	CHECK(!model.IsVariableDirty("title"));
+	model.Update(true);
+
+	title = "second";
+	list.push_back(4);
+	model.Update(false);
+	CHECK(!model.IsVariableDirty("counter"));
+	CHECK(model.IsVariableDirty("title"));
+	CHECK(!model.IsVariableDirty("list"));
+	model.Update(true);
+
+	handle.SetChangeDetection(false);
+	counter = 6;
+	model.Update(false);
+	CHECK(!model.IsVariableDirty("counter"));
+}
+
+TEST_CASE("Data model posted updates")
+{
+	DataModel model;
+	DataTypeRegister types;
+
+	DataModelConstructor handle(&model, &types);
+
+	struct Position {
+		int x = 0;
+		int y = 0;
+	};
+	if (auto position_handle = handle.RegisterStruct<Position>())
+	{
+		position_handle.RegisterMember("x", &Position::x);
+		position_handle.RegisterMember("y", &Position::y);
+	}
+
+	Position position;
+	int counter = 0;
+	handle.Bind("position", &position);
+	handle.Bind("counter", &counter);
+
+	DataModelHandle model_handle = handle.GetModelHandle();
+
+	constexpr int num_posts = 1000;
+	std::thread producer_a([&]() {
+		for (int i = 1; i <= num_posts; i++)
+			model_handle.PostVariableUpdate("position.x", Variant(i));
+	});
+	std::thread producer_b([&]() {
+		for (int i = 1; i <= num_posts; i++)
+			model_handle.PostVariableUpdate("counter", Variant(i));
+	});
+	producer_a.join();
+	producer_b.join();
+
+	CHECK(position.x == 0);
+	CHECK(counter == 0);
+
+	model.Update(false);
+	CHECK(position.x == num_posts);
+	CHECK(position.y == 0);
+	CHECK(counter == num_posts);
+	CHECK(model.IsVariableDirty("position"));
+	CHECK(model.IsVariableDirty("counter"));
+}
+
+static const String data_view_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<link type="text/rcss" href="/assets/invader.rcss"/>
+</head>
+<body>
+<div data-model="views">
+	<div id="list"><p data-for="value : values">{{ value }}</p></div>
+	<span id="title" data-style-color="colour">{{ title }}</span>
+</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("Data model views")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	Vector<int> values = { 1, 2, 3 };
+	String title = "Title";
+	String colour = "red";
+
+	DataModelConstructor constructor = context->CreateDataModel("views");
+	REQUIRE(static_cast<bool>(constructor));
+	constructor.RegisterArray<Vector<int>>();
+	constructor.Bind("values", &values);
+	constructor.Bind("title", &title);
+	constructor.Bind("colour", &colour);
+	DataModelHandle handle = constructor.GetModelHandle();
+
+	ElementDocument* document = context->LoadDocumentFromMemory(data_view_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* list = document->GetElementById("list");
+	Element* title_element = document->GetElementById("title");
+	REQUIRE(list);
+	REQUIRE(title_element);
+
+	context->Update();
+	CHECK(list->GetNumChildren() == 4);
+	CHECK(list->GetChild(2)->GetInnerRML() == "3");
+	CHECK(title_element->GetInnerRML() == "Title");
+
+	values.resize(1000, 5);
+	handle.DirtyVariable("values");
+	context->Update();
+	CHECK(list->GetNumChildren() == 1001);
+	CHECK(list->GetChild(999)->GetInnerRML() == "5");
+
+	values = { 7, 8 };
+	handle.DirtyVariable("values");
+	context->Update();
+	CHECK(list->GetNumChildren() == 3);
+	CHECK(list->GetChild(1)->GetInnerRML() == "8");
+
+	title = "New title";
+	handle.DirtyVariable("title");
+	handle.DirtyVariable("colour");
+	context->Update();
+	CHECK(title_element->GetInnerRML() == "New title");
+	CHECK(title_element->GetLocalProperty("color")->ToString() == "rgba(255,0,0,255)");
+
+	colour = "blue";
+	handle.DirtyVariable("colour");
+	context->Update();
+	CHECK(title_element->GetComputedValues().color.blue == 255);
+
+	document->Close();
+	context->Update();
+	context->RemoveDataModel("views");
+
+	TestsShell::ShutdownShell();
+}
+
+static const String data_view_change_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { font-family: LatoLatin; }
+		width-observer { display: block; }
+	</style>
+</head>
+<body>
+<div data-model="view_changes">
+	<width-observer id="box" data-style-width="width">{{ text }}</width-observer>
+</div>
+</body>
+</rml>
+)";
+
+// Counts the notifications about changes to its width.
+class ElementWidthObserver : public Element {
+public:
+	ElementWidthObserver(const String& tag) : Element(tag) {}
+
+	int num_width_changes = 0;
+
+protected:
+	void OnPropertyChange(const PropertyIdSet& changed_properties) override
+	{
+		Element::OnPropertyChange(changed_properties);
+		if (changed_properties.Contains(PropertyId::Width))
+			num_width_changes += 1;
+	}
+};
+
+TEST_CASE("Data model view change detection")
+{
+	ElementInstancerGeneric<ElementWidthObserver> instancer;
+	Factory::RegisterElementInstancer("width-observer", &instancer);
+
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	String width = "100px";
+	String text = "first";
+
+	DataModelConstructor constructor = context->CreateDataModel("view_changes");
+	REQUIRE(static_cast<bool>(constructor));
+	constructor.Bind("width", &width);
+	constructor.Bind("text", &text);
+	DataModelHandle handle = constructor.GetModelHandle();
+
+	ElementDocument* document = context->LoadDocumentFromMemory(data_view_change_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	auto box = static_cast<ElementWidthObserver*>(document->GetElementById("box"));
+	REQUIRE(box);
+	REQUIRE(box->GetNumChildren() == 1);
+	ElementText* text_element = rmlui_dynamic_cast<ElementText*>(box->GetChild(0));
+	REQUIRE(text_element);
+
+	CHECK(box->GetComputedValues().width.value == 100.f);
+	CHECK(text_element->GetText() == "first");
+	const int num_width_changes = box->num_width_changes;
+
+	// Unchanged values must not be written to the element.
+	text_element->SetText("external");
+	handle.DirtyVariable("width");
+	handle.DirtyVariable("text");
+	context->Update();
+	CHECK(box->num_width_changes == num_width_changes);
+	CHECK(text_element->GetText() == "external");
+
+	// Changed values are written to the element.
+	width = "50px";
+	text = "second";
+	handle.DirtyVariable("width");
+	handle.DirtyVariable("text");
+	context->Update();
+	CHECK(box->num_width_changes == num_width_changes + 1);
+	CHECK(box->GetComputedValues().width.value == 50.f);
+	CHECK(text_element->GetText() == "second");
+
+	// The bound value is restored when the property was changed outside the view.
+	box->SetProperty("width", "20px");
+	context->Update();
+	CHECK(box->GetComputedValues().width.value == 20.f);
+	handle.DirtyVariable("width");
+	context->Update();
+	CHECK(box->GetComputedValues().width.value == 50.f);
+
+	document->Close();
+	context->Update();
+	context->RemoveDataModel("view_changes");
+
+	TestsShell::ShutdownShell();
+}
@@ -0,0 +1,127 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsInterface.h"
+#include "../Common/TestsShell.h"
+#include "../../../Source/Core/DecoratorGeometryCache.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Core.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <doctest.h>
+
+using namespace Rml;
+
+static const String document_slots_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<style>
+		body { display: block; width: 500px; height: 500px; }
+		div { display: inline-block; width: 20px; height: 20px; margin: 2px; decorator: gradient(vertical #f00 #00f); }
+		#wide { width: 40px; }
+	</style>
+</head>
+
+<body>
+<div/><div/><div/><div/><div/><div/><div/><div/><div/><div/>
+<div/><div/><div/><div/><div/><div/><div/><div/><div/><div/>
+<div id="wide"/>
+</body>
+</rml>
+)";
+
+// Returns the distinct translations of the recorded render calls.
+static SmallOrderedSet<Vector2f> GetRenderedTranslations(const TestsRenderInterface& render_interface)
+{
+	SmallOrderedSet<Vector2f> translations;
+	for (const TestsRenderInterface::RenderedGeometry& geometry : render_interface.GetRecording().geometry)
+		translations.insert(geometry.translation);
+	return translations;
+}
+
+TEST_CASE("decorator_geometry_cache")
+{
+	TestsRenderInterface::Options options;
+	options.record_geometry = true;
+	options.compile_geometry = true;
+	TestsRenderInterface render_interface(options);
+	Context* context = TestsShell::CreateContext("decorator_geometry_cache", Vector2i(500, 500), &render_interface);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_slots_rml);
+	REQUIRE(document);
+	document->Show();
+
+	context->Update();
+	context->Render();
+
+	// All the equally sized slots share their geometry, while still being rendered at their own positions.
+	CHECK(DecoratorGeometryCache::GetNumEntries(context) == 2);
+	CHECK(render_interface.GetCounters().compile_geometry == 2);
+	CHECK(GetRenderedTranslations(render_interface).size() == 21);
+
+	// Resizing a slot gives it its own geometry, without affecting the others.
+	document->GetFirstChild()->SetProperty(PropertyId::Height, Property(30.f, Property::PX));
+	context->Update();
+	context->Render();
+
+	CHECK(DecoratorGeometryCache::GetNumEntries(context) == 3);
+	CHECK(render_interface.GetCounters().compile_geometry == 3);
+
+	// Translucent slots get their own geometry, so that their opacity copies are not rebuilt for each other every frame.
+	Element* translucent_a = document->GetChild(1);
+	Element* translucent_b = document->GetChild(2);
+	translucent_a->SetProperty(PropertyId::Opacity, Property(0.5f, Property::NUMBER));
+	translucent_b->SetProperty(PropertyId::Opacity, Property(0.25f, Property::NUMBER));
+	context->Update();
+	context->Render();
+
+	CHECK(DecoratorGeometryCache::GetNumEntries(context) == 5);
+
+	const size_t num_compiled = render_interface.GetCounters().compile_geometry;
+	context->Render();
+	context->Render();
+	CHECK(render_interface.GetCounters().compile_geometry == num_compiled);
+
+	// Once opaque again, the slot shares its geometry with the others.
+	translucent_a->RemoveProperty(PropertyId::Opacity);
+	context->Update();
+	context->Render();
+
+	CHECK(DecoratorGeometryCache::GetNumEntries(context) == 4);
+
+	// The geometry is released once the last element using it is gone.
+	document->Close();
+	context->Update();
+
+	CHECK(DecoratorGeometryCache::GetNumEntries(context) == 0);
+	CHECK(render_interface.GetCounters().release_compiled_geometry == render_interface.GetCounters().compile_geometry);
+
+	TestsShell::RemoveContext(context);
+
+	TestsShell::ShutdownShell();
+}
@@ -26,11 +26,21 @@
  *
  */
 
+#include "../Common/TestsInterface.h"
 #include "../Common/TestsShell.h"
+#include "../../../Source/Core/HitTestGrid.h"
 #include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Core.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/ElementUtilities.h>
+#include <RmlUi/Core/ElementInstancer.h>
+#include <RmlUi/Core/EventListener.h>
+#include <RmlUi/Core/Factory.h>
+#include <RmlUi/Core/PropertyIdSet.h>
+#include <RmlUi/Core/Transform.h>
 #include <doctest.h>
+#include <functional>
 
 using namespace Rml;
 
@@ -103,3 +113,951 @@ TEST_CASE("element.clone")
 
 	TestsShell::ShutdownShell();
 }
+
+static const String document_hit_test_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			left: 0;
+			top: 0;
+			right: 0;
+			bottom: 0;
+		}
+		div {
+			position: absolute;
+			width: 8px;
+			height: 8px;
+		}
+	</style>
+</head>
+
+<body/>
+</rml>
+)";
+
+TEST_CASE("element.hit_test")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_hit_test_rml);
+	REQUIRE(document);
+	document->Show();
+
+	// Enough elements in the document's stacking context to use the hit test grid.
+	constexpr int num_rows = 10;
+	constexpr int num_columns = 10;
+
+	for (int i = 0; i < num_rows * num_columns; i++)
+	{
+		Element* element = document->AppendChild(document->CreateElement("div"));
+		element->SetId(CreateString(16, "div%d", i));
+		element->SetProperty(PropertyId::Left, Property(float(10 * (i % num_columns)), Property::PX));
+		element->SetProperty(PropertyId::Top, Property(float(10 * (i / num_columns)), Property::PX));
+	}
+
+	context->Update();
+	context->Render();
+
+	for (int i = 0; i < num_rows * num_columns; i++)
+	{
+		const Vector2f point(float(10 * (i % num_columns) + 4), float(10 * (i / num_columns) + 4));
+		Element* hit_element = context->GetElementAtPoint(point);
+		REQUIRE(hit_element);
+		CHECK(hit_element->GetId() == CreateString(16, "div%d", i));
+	}
+
+	// Points between the elements hit the document itself.
+	CHECK(context->GetElementAtPoint(Vector2f(9, 9)) == document);
+
+	const int num_placed_elements = HitTestGrid::GetNumPlacedElements(document);
+	CHECK(num_placed_elements >= num_rows * num_columns);
+
+	// Moving an element must be reflected by the next hit test, even outside the area of the grid.
+	Element* moved_element = document->GetElementById("div0");
+	moved_element->SetProperty(PropertyId::Left, Property(200.f, Property::PX));
+	moved_element->SetProperty(PropertyId::Top, Property(200.f, Property::PX));
+
+	context->Update();
+
+	CHECK(context->GetElementAtPoint(Vector2f(4, 4)) == document);
+	CHECK(context->GetElementAtPoint(Vector2f(204, 204)) == moved_element);
+
+	// Only the entry of the moved element is updated, the other entries are left in place.
+	CHECK(HitTestGrid::GetNumPlacedElements(document) == num_placed_elements + 1);
+
+	for (int i = 1; i < num_rows * num_columns; i++)
+	{
+		const Vector2f point(float(10 * (i % num_columns) + 4), float(10 * (i / num_columns) + 4));
+		CHECK(context->GetElementAtPoint(point)->GetId() == CreateString(16, "div%d", i));
+	}
+	CHECK(HitTestGrid::GetNumPlacedElements(document) == num_placed_elements + 1);
+
+	moved_element->SetProperty(PropertyId::Left, Property(-50.f, Property::PX));
+	context->Update();
+	CHECK(context->GetElementAtPoint(Vector2f(-46, 204)) == moved_element);
+	CHECK(HitTestGrid::GetNumPlacedElements(document) == num_placed_elements + 2);
+
+	// Elements stacked on top are hit first.
+	moved_element->SetProperty(PropertyId::Left, Property(10.f, Property::PX));
+	moved_element->SetProperty(PropertyId::Top, Property(10.f, Property::PX));
+	moved_element->SetProperty(PropertyId::ZIndex, Property(1.f, Property::NUMBER));
+
+	context->Update();
+
+	CHECK(context->GetElementAtPoint(Vector2f(14, 14)) == moved_element);
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
+
+class EventOrderListener : public EventListener {
+public:
+	EventOrderListener(String name, Vector<String>& log) : name(std::move(name)), log(log) {}
+
+	void ProcessEvent(Event& event) override
+	{
+		log.push_back(name + ":" + event.GetType());
+
+		// Dispatch a nested event from within the dispatch, which must not disturb the outer event.
+		if (event == "click" && name == "inner_first")
+			event.GetTargetElement()->DispatchEvent("nested", Dictionary(), false, false);
+	}
+
+private:
+	String name;
+	Vector<String>& log;
+};
+
+TEST_CASE("element.event_order")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_hit_test_rml);
+	REQUIRE(document);
+
+	Element* outer = document->AppendChild(document->CreateElement("p"));
+	Element* inner = outer->AppendChild(document->CreateElement("span"));
+
+	Vector<String> log;
+	EventOrderListener outer_capture("outer_capture", log), outer_bubble("outer_bubble", log);
+	EventOrderListener inner_first("inner_first", log), inner_second("inner_second", log);
+
+	outer->AddEventListener("click", &outer_bubble, false);
+	outer->AddEventListener("click", &outer_capture, true);
+	inner->AddEventListener("click", &inner_first, false);
+	inner->AddEventListener("nested", &inner_second, false);
+	inner->AddEventListener("click", &inner_second, true);
+
+	const Vector<String> expected_log = {
+		"outer_capture:click",
+		"inner_first:click",
+		"inner_second:nested",
+		"inner_second:click",
+		"outer_bubble:click",
+	};
+
+	// Run it twice to exercise the reused dispatch buffers and events.
+	for (int i = 0; i < 2; i++)
+	{
+		log.clear();
+		inner->DispatchEvent("click", Dictionary());
+		CHECK(log == expected_log);
+	}
+
+	// Non-bubbling events skip the bubble phase.
+	log.clear();
+	inner->DispatchEvent("click", Dictionary(), true, false);
+	CHECK(log == Vector<String>{ "outer_capture:click", "inner_first:click", "inner_second:nested", "inner_second:click" });
+
+	outer->RemoveEventListener("click", &outer_bubble, false);
+	outer->RemoveEventListener("click", &outer_capture, true);
+	inner->RemoveEventListener("click", &inner_first, false);
+	inner->RemoveEventListener("nested", &inner_second, false);
+	inner->RemoveEventListener("click", &inner_second, true);
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
+
+static const String document_update_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { font-family: LatoLatin; }
+		.red { color: #f00; }
+	</style>
+</head>
+
+<body>
+<div><div><p>Some <span id="span">static</span> text</p></div></div>
+<div id="sibling"/>
+</body>
+</rml>
+)";
+
+TEST_CASE("element.update_clean_subtrees")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_update_rml);
+	REQUIRE(document);
+	document->Show();
+
+	// Let the tree settle, after which the static parts of the tree are skipped during update.
+	context->Update();
+	context->Update();
+
+	Element* span = document->GetElementById("span");
+	REQUIRE(span);
+
+	// Changes deep inside skipped subtrees must still be picked up.
+	span->SetProperty(PropertyId::Color, Property(Colourb(0, 0, 255), Property::COLOUR));
+	context->Update();
+	CHECK(span->GetComputedValues().color.blue == 255);
+
+	span->RemoveProperty(PropertyId::Color);
+	span->SetClass("red", true);
+	context->Update();
+	CHECK(span->GetComputedValues().color.red == 255);
+	CHECK(span->GetComputedValues().color.blue == 0);
+
+	// Inherited changes on an ancestor propagate down through the clean subtree.
+	span->SetClass("red", false);
+	document->SetProperty(PropertyId::Color, Property(Colourb(0, 255, 0), Property::COLOUR));
+	context->Update();
+	CHECK(span->GetComputedValues().color.green == 255);
+
+	// Newly attached elements are updated.
+	Element* sibling = document->GetElementById("sibling");
+	Element* child = sibling->AppendChild(document->CreateElement("p"));
+	context->Update();
+	CHECK(child->GetComputedValues().color.green == 255);
+
+	// Inherited changes also reach subtrees which nothing else has dirtied.
+	context->Update();
+	document->SetProperty(PropertyId::Color, Property(Colourb(10, 20, 30), Property::COLOUR));
+	context->Update();
+	CHECK(sibling->GetComputedValues().color.red == 10);
+	CHECK(sibling->GetComputedValues().color.blue == 30);
+	CHECK(child->GetComputedValues().color.red == 10);
+	CHECK(child->GetComputedValues().color.blue == 30);
+	CHECK(span->GetComputedValues().color.red == 10);
+	CHECK(span->GetComputedValues().color.blue == 30);
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("element.animation_timeline")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	// Animations are advanced in controlled steps.
+	TestsShell::SetElapsedTime(1.0);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_update_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	Element* span = document->GetElementById("span");
+	Element* sibling = document->GetElementById("sibling");
+	REQUIRE(span);
+	REQUIRE(sibling);
+
+	struct AnimationEndListener : EventListener {
+		void ProcessEvent(Event& event) override { properties.push_back(event.GetParameter<String>("property", "")); }
+		Vector<String> properties;
+	} listener;
+	span->AddEventListener(EventId::Animationend, &listener);
+
+	// Background colour is written directly to the computed values, while width goes through the style system.
+	span->SetProperty(PropertyId::BackgroundColor, Property(Colourb(255, 0, 0), Property::COLOUR));
+	sibling->SetProperty(PropertyId::Width, Property(10.f, Property::PX));
+	context->Update();
+
+	REQUIRE(span->Animate("background-color", Property(Colourb(0, 0, 255), Property::COLOUR), 0.05f));
+	REQUIRE(sibling->Animate("width", Property(20.f, Property::PX), 0.05f));
+	context->Update();
+
+	CHECK(span->GetComputedValues().background_color.red == 255);
+
+	TestsShell::SetElapsedTime(1.025);
+	context->Update();
+
+	CHECK(span->GetComputedValues().background_color.red > 0);
+	CHECK(span->GetComputedValues().background_color.red < 255);
+
+	TestsShell::SetElapsedTime(1.1);
+	context->Update();
+
+	CHECK(span->GetComputedValues().background_color.red == 0);
+	CHECK(span->GetComputedValues().background_color.blue == 255);
+	CHECK(span->GetProperty(PropertyId::BackgroundColor)->Get<Colourb>().blue == 255);
+	CHECK(sibling->GetComputedValues().width.value == 20.f);
+	CHECK(listener.properties == Vector<String>{ "background-color" });
+
+	// Animations are removed from the timeline along with their element.
+	REQUIRE(sibling->Animate("width", Property(30.f, Property::PX), 0.05f));
+	context->Update();
+	sibling->GetParentNode()->RemoveChild(sibling);
+	context->Update();
+
+	span->RemoveEventListener(EventId::Animationend, &listener);
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
+
+// Starts new animations on itself when its background color is animated, while the timeline is applying values.
+class ElementAnimateOnChange : public Element {
+public:
+	ElementAnimateOnChange(const String& tag) : Element(tag) {}
+
+protected:
+	void OnPropertyChange(const PropertyIdSet& changed_properties) override
+	{
+		Element::OnPropertyChange(changed_properties);
+
+		if (!animations_started && changed_properties.Contains(PropertyId::BackgroundColor))
+		{
+			animations_started = true;
+			for (const char* property : {"color", "image-color", "border-left-color", "border-right-color", "border-bottom-color"})
+				Animate(property, Property(Colourb(0, 0, 255), Property::COLOUR), 0.1f);
+			Animate("opacity", Property(0.5f, Property::NUMBER), 0.1f);
+		}
+	}
+
+private:
+	bool animations_started = false;
+};
+
+TEST_CASE("element.animation_timeline_start_during_update")
+{
+	ElementInstancerGeneric<ElementAnimateOnChange> instancer;
+	Factory::RegisterElementInstancer("animate-on-change", &instancer);
+
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	TestsShell::SetElapsedTime(1.0);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_update_rml);
+	REQUIRE(document);
+	document->Show();
+
+	ElementPtr element_ptr = Factory::InstanceElement(document, "animate-on-change", "animate-on-change", XMLAttributes());
+	REQUIRE(element_ptr);
+	Element* element = document->AppendChild(std::move(element_ptr));
+	element->SetProperty(PropertyId::BackgroundColor, Property(Colourb(255, 0, 0), Property::COLOUR));
+	element->SetProperty(PropertyId::BorderTopColor, Property(Colourb(255, 0, 0), Property::COLOUR));
+	context->Update();
+
+	// Both animations modify their properties directly, and the first one starts several new animations on the element.
+	REQUIRE(element->Animate("background-color", Property(Colourb(0, 0, 255), Property::COLOUR), 0.1f));
+	REQUIRE(element->Animate("border-top-color", Property(Colourb(0, 0, 255), Property::COLOUR), 0.1f));
+	context->Update();
+
+	TestsShell::SetElapsedTime(1.05);
+	context->Update();
+
+	const ComputedValues& computed = element->GetComputedValues();
+	CHECK(computed.background_color.red > 0);
+	CHECK(computed.background_color.red < 255);
+	CHECK(computed.border_top_color.red > 0);
+	CHECK(computed.border_top_color.red < 255);
+
+	TestsShell::SetElapsedTime(1.2);
+	context->Update();
+	TestsShell::SetElapsedTime(1.4);
+	context->Update();
+
+	CHECK(computed.background_color.blue == 255);
+	CHECK(computed.border_top_color.blue == 255);
+	CHECK(computed.border_left_color.blue == 255);
+	CHECK(computed.opacity == 0.5f);
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
+
+static const String document_transition_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { font-family: LatoLatin; }
+		#fade { transition: opacity transform 0.05s linear-in-out; }
+		#fade.faded { opacity: 0.5; transform: translateX(10px); }
+	</style>
+</head>
+
+<body>
+<div id="fade"><p id="child">Fading text</p></div>
+</body>
+</rml>
+)";
+
+TEST_CASE("element.animation_transform_opacity")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	TestsShell::SetElapsedTime(1.0);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_transition_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+	context->Render();
+
+	Element* fade = document->GetElementById("fade");
+	Element* child = document->GetElementById("child");
+	REQUIRE(fade);
+	REQUIRE(child);
+
+	fade->SetClass("faded", true);
+	context->Update();
+	context->Render();
+
+	TestsShell::SetElapsedTime(1.1);
+	context->Update();
+	context->Render();
+
+	// The animated values must be applied to the element and inherited by its children, just like regular properties.
+	CHECK(fade->GetComputedValues().opacity == 0.5f);
+	CHECK(child->GetComputedValues().opacity == 0.5f);
+	CHECK(static_cast<bool>(fade->GetComputedValues().transform));
+	CHECK(fade->GetTransformState() != nullptr);
+
+	fade->SetClass("faded", false);
+	context->Update();
+
+	TestsShell::SetElapsedTime(1.2);
+	context->Update();
+	context->Render();
+
+	CHECK(fade->GetComputedValues().opacity == 1.f);
+	CHECK(child->GetComputedValues().opacity == 1.f);
+	CHECK(!static_cast<bool>(fade->GetComputedValues().transform));
+	CHECK(fade->GetTransformState() == nullptr);
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
+
+// Counts the notifications about changes to its transform.
+class ElementTransformObserver : public Element {
+public:
+	ElementTransformObserver(const String& tag) : Element(tag) {}
+
+	int num_transform_changes = 0;
+
+protected:
+	void OnPropertyChange(const PropertyIdSet& changed_properties) override
+	{
+		Element::OnPropertyChange(changed_properties);
+		if (changed_properties.Contains(PropertyId::Transform))
+			num_transform_changes += 1;
+	}
+};
+
+TEST_CASE("element.animation_transform_notification")
+{
+	ElementInstancerGeneric<ElementTransformObserver> instancer;
+	Factory::RegisterElementInstancer("transform-observer", &instancer);
+
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	TestsShell::SetElapsedTime(1.0);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_transition_rml);
+	REQUIRE(document);
+	document->Show();
+
+	ElementPtr element_ptr = Factory::InstanceElement(document, "transform-observer", "transform-observer", XMLAttributes());
+	REQUIRE(element_ptr);
+	auto observer = static_cast<ElementTransformObserver*>(document->AppendChild(std::move(element_ptr)));
+	observer->SetProperty("transform", "translateX(0px)");
+	context->Update();
+
+	REQUIRE(observer->Animate("transform", Transform::MakeProperty({Transforms::TranslateX(10.f)}), 0.1f));
+	context->Update();
+	const int num_changes_started = observer->num_transform_changes;
+
+	// Animated transforms bypass the style computation, but derived elements must still be notified of every change.
+	TestsShell::SetElapsedTime(1.05);
+	context->Update();
+	CHECK(observer->num_transform_changes == num_changes_started + 1);
+
+	TestsShell::SetElapsedTime(1.2);
+	context->Update();
+	context->Render();
+	CHECK(observer->num_transform_changes == num_changes_started + 2);
+	CHECK(observer->GetTransformState() != nullptr);
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
+
+static const String document_opacity_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<style>
+		body { display: block; width: 100px; height: 100px; }
+		div { display: block; width: 50px; height: 50px; background-color: #f00; opacity: 0.5; }
+	</style>
+</head>
+
+<body>
+<div id="box"/>
+</body>
+</rml>
+)";
+
+// Returns the alpha of every rendered vertex after any opacity applied by the renderer.
+static Vector<byte> GetRenderedAlphas(const TestsRenderInterface& render_interface, bool apply_opacity)
+{
+	Vector<byte> alphas;
+	for (const TestsRenderInterface::RenderedGeometry& geometry : render_interface.GetRecording().geometry)
+	{
+		const float multiplier = (apply_opacity ? geometry.opacity : 1.f);
+		for (const Vertex& vertex : geometry.vertices)
+			alphas.push_back(byte(multiplier * float(vertex.colour.alpha)));
+	}
+	return alphas;
+}
+
+TEST_CASE("element.opacity")
+{
+	for (bool apply_opacity : { false, true })
+	{
+		TestsRenderInterface::Options options;
+		options.record_geometry = true;
+		options.apply_opacity = apply_opacity;
+		TestsRenderInterface render_interface(options);
+		Context* context = TestsShell::CreateContext("opacity", Vector2i(100, 100), &render_interface);
+
+		ElementDocument* document = context->LoadDocumentFromMemory(document_opacity_rml);
+		REQUIRE(document);
+		document->Show();
+
+		context->Update();
+		context->Render();
+
+		// Opacity is applied at render time either by the renderer, or by RmlUi to a copy of the geometry.
+		Vector<byte> alphas = GetRenderedAlphas(render_interface, apply_opacity);
+		REQUIRE(!alphas.empty());
+		for (byte alpha : alphas)
+			CHECK(alpha == byte(0.5f * 255.f));
+
+		// The opacity is reset once the context has been rendered.
+		CHECK(render_interface.GetCounters().set_opacity == 2);
+		CHECK(render_interface.GetOpacity() == 1.f);
+
+		// Only the submitted opacity changes, the geometry itself is unaffected by opacity.
+		Element* box = document->GetElementById("box");
+		REQUIRE(box);
+		box->SetProperty(PropertyId::Opacity, Property(1.f, Property::NUMBER));
+		render_interface.ResetRecording();
+		context->Update();
+		context->Render();
+
+		alphas = GetRenderedAlphas(render_interface, apply_opacity);
+		REQUIRE(!alphas.empty());
+		for (byte alpha : alphas)
+			CHECK(alpha == 255);
+		CHECK(render_interface.GetCounters().set_opacity == 2);
+
+		document->Close();
+		context->Update();
+		TestsShell::RemoveContext(context);
+	}
+
+	TestsShell::ShutdownShell();
+}
+
+static const String document_culling_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<style>
+		body { display: block; width: 100px; height: 100px; }
+		#panel { display: block; height: 100px; overflow: hidden; }
+		#panel div { display: block; height: 20px; background-color: #f00; }
+	</style>
+</head>
+
+<body>
+<div id="panel"/>
+</body>
+</rml>
+)";
+
+TEST_CASE("element.render_culling")
+{
+	TestsRenderInterface::Options options;
+	options.record_geometry = true;
+	TestsRenderInterface render_interface(options);
+	Context* context = TestsShell::CreateContext("culling", Vector2i(100, 100), &render_interface);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_culling_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* panel = document->GetElementById("panel");
+	REQUIRE(panel);
+	for (int i = 0; i < 100; i++)
+		panel->AppendChild(document->CreateElement("div"));
+
+	context->Update();
+	context->Render();
+
+	// Only the five visible children should have their background rendered, each with a single quad.
+	const int num_quad_vertices = 4;
+	CHECK(render_interface.GetNumRenderedVertices() == 5 * num_quad_vertices);
+
+	panel->SetScrollTop(1010.f);
+	render_interface.ResetRecording();
+	context->Update();
+	context->Render();
+
+	// The panel is scrolled halfway into a child, now six children are partially visible.
+	CHECK(render_interface.GetNumRenderedVertices() == 6 * num_quad_vertices);
+
+	document->Close();
+	context->Update();
+	TestsShell::RemoveContext(context);
+
+	TestsShell::ShutdownShell();
+}
+
+static const String document_render_cache_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<style>
+		body { display: block; width: 100px; height: 100px; }
+		#cached { display: block; }
+		#cached div { display: block; height: 10px; background-color: #f00; }
+	</style>
+</head>
+
+<body>
+<div id="cached" render-cache>
+	<div/><div/><div/><div/><div/>
+	<div/><div/><div/><div/><div id="last"/>
+</div>
+</body>
+</rml>
+)";
+
+// Returns the number of recorded render calls using a texture, as only the render cache textures are used here.
+static int GetNumTextureRenderCalls(const TestsRenderInterface& render_interface)
+{
+	int num_texture_render_calls = 0;
+	for (const TestsRenderInterface::RenderedGeometry& geometry : render_interface.GetRecording().geometry)
+		num_texture_render_calls += (geometry.texture != 0);
+	return num_texture_render_calls;
+}
+
+TEST_CASE("element.render_cache")
+{
+	TestsRenderInterface::Options options;
+	options.record_geometry = true;
+	options.render_to_texture = true;
+	TestsRenderInterface render_interface(options);
+	Context* context = TestsShell::CreateContext("render_cache", Vector2i(100, 100), &render_interface);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_render_cache_rml);
+	REQUIRE(document);
+	document->Show();
+
+	context->Update();
+	context->Render();
+
+	// The children are rendered into the texture, followed by the texture itself.
+	const TestsRenderInterface::Recording& recording = render_interface.GetRecording();
+	REQUIRE(recording.render_to_texture_dimensions.size() == 1);
+	CHECK(recording.render_to_texture_dimensions[0] == Vector2i(100, 100));
+	CHECK(recording.geometry.size() == 10 + 1);
+	CHECK(GetNumTextureRenderCalls(render_interface) == 1);
+
+	// Nothing changed, only the texture should be rendered.
+	render_interface.ResetRecording();
+	context->Update();
+	context->Render();
+
+	CHECK(recording.render_to_texture_dimensions.size() == 0);
+	CHECK(recording.geometry.size() == 1);
+	CHECK(GetNumTextureRenderCalls(render_interface) == 1);
+
+	// Changing any descendant renders the texture again.
+	Element* last = document->GetElementById("last");
+	REQUIRE(last);
+	last->SetProperty(PropertyId::BackgroundColor, Property(Colourb(0, 255, 0), Property::COLOUR));
+
+	render_interface.ResetRecording();
+	context->Update();
+	context->Render();
+
+	CHECK(recording.render_to_texture_dimensions.size() == 1);
+	CHECK(recording.geometry.size() == 10 + 1);
+	CHECK(render_interface.GetCounters().release_texture == 1);
+
+	// Disabling the cache renders the elements directly.
+	Element* cached = document->GetElementById("cached");
+	REQUIRE(cached);
+	cached->RemoveAttribute("render-cache");
+
+	render_interface.ResetRecording();
+	context->Update();
+	context->Render();
+
+	CHECK(recording.render_to_texture_dimensions.size() == 0);
+	CHECK(recording.geometry.size() == 10);
+	CHECK(render_interface.GetCounters().release_texture == 2);
+
+	document->Close();
+	context->Update();
+	TestsShell::RemoveContext(context);
+
+	TestsShell::ShutdownShell();
+}
+
+static const String document_clipping_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<style>
+		body { display: block; width: 100px; height: 100px; }
+		div { display: block; }
+		#outer { height: 50px; overflow: hidden; }
+		#inner { margin-left: 10px; width: 50px; height: 30px; overflow: hidden; }
+		.leaf { height: 40px; background-color: #f00; }
+	</style>
+</head>
+
+<body>
+<div id="outer">
+	<div id="inner">
+		<div class="leaf" id="a"/>
+		<div class="leaf" id="b" style="clip: 1"/>
+		<div class="leaf" id="c" style="clip: none"/>
+	</div>
+	<div class="leaf" id="d"/>
+</div>
+</body>
+</rml>
+)";
+
+// Returns the scissor region of each recorded render call, or -1 when scissoring is disabled.
+static Vector<Vector4i> GetRenderedScissorRegions(const TestsRenderInterface& render_interface)
+{
+	Vector<Vector4i> regions;
+	for (const TestsRenderInterface::RenderedGeometry& geometry : render_interface.GetRecording().geometry)
+		regions.push_back(geometry.scissor_region);
+	return regions;
+}
+
+TEST_CASE("element.clipping_region")
+{
+	TestsRenderInterface::Options options;
+	options.record_geometry = true;
+	TestsRenderInterface render_interface(options);
+	Context* context = TestsShell::CreateContext("clipping", Vector2i(100, 100), &render_interface);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_clipping_rml);
+	REQUIRE(document);
+	document->Show();
+
+	context->Update();
+	context->Render();
+
+	// The regions used during rendering, where the clipping regions are cached, should match the ones computed outside rendering.
+	const Vector4i none(-1);
+	const Vector<Vector4i> expected_regions = {
+		Vector4i(10, 0, 50, 30),
+		Vector4i(0, 0, 100, 50),
+		none,
+		Vector4i(0, 0, 100, 50),
+	};
+	CHECK(GetRenderedScissorRegions(render_interface) == expected_regions);
+
+	const char* ids[] = { "a", "b", "c", "d" };
+	for (size_t i = 0; i < expected_regions.size(); i++)
+	{
+		Vector2i origin, dimensions;
+		Vector4i region = none;
+		if (ElementUtilities::GetClippingRegion(origin, dimensions, document->GetElementById(ids[i])))
+			region = Vector4i(origin.x, origin.y, dimensions.x, dimensions.y);
+		CHECK(region == expected_regions[i]);
+	}
+
+	// Moving a clipping element between frames must be reflected in the regions of its descendants.
+	document->GetElementById("inner")->SetProperty(PropertyId::MarginLeft, Property(20.f, Property::PX));
+	render_interface.ResetRecording();
+	context->Update();
+	context->Render();
+
+	const Vector<Vector4i> regions = GetRenderedScissorRegions(render_interface);
+	REQUIRE(regions.size() == 4);
+	CHECK(regions[0] == Vector4i(20, 0, 50, 30));
+
+	document->Close();
+	context->Update();
+	TestsShell::RemoveContext(context);
+
+	TestsShell::ShutdownShell();
+}
+
+static const String document_lookup_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<style>
+		body { display: block; width: 100px; height: 100px; }
+	</style>
+</head>
+
+<body>
+<div id="a" class="x">
+	<p id="b" class="x y"/>
+	<div id="c">
+		<p class="y x"/>
+		<span id="b"/>
+	</div>
+</div>
+<div class="x">
+	<p id="d"/>
+</div>
+</body>
+</rml>
+)";
+
+// Breadth-first searches as done without the document indexes.
+static void ReferenceSearch(ElementList& elements, Element* root_element, const std::function<bool(Element*)>& predicate, bool include_root)
+{
+	Vector<Element*> queue = { root_element };
+	for (size_t i = 0; i < queue.size(); i++)
+	{
+		Element* element = queue[i];
+		if ((element != root_element || include_root) && predicate(element))
+			elements.push_back(element);
+
+		for (int j = 0; j < element->GetNumChildren(); j++)
+			queue.push_back(element->GetChild(j));
+	}
+}
+
+static bool LookupsMatchReference(Element* root_element)
+{
+	bool result = true;
+
+	for (const char* id : { "a", "b", "c", "d", "e" })
+	{
+		ElementList expected;
+		ReferenceSearch(expected, root_element, [&](Element* element) { return element->GetId() == id; }, true);
+		result &= (ElementUtilities::GetElementById(root_element, id) == (expected.empty() ? nullptr : expected.front()));
+	}
+
+	for (const char* tag : { "div", "p", "span", "#text" })
+	{
+		ElementList expected, elements;
+		ReferenceSearch(expected, root_element, [&](Element* element) { return element->GetTagName() == tag; }, false);
+		ElementUtilities::GetElementsByTagName(elements, root_element, tag);
+		result &= (elements == expected);
+	}
+
+	for (const char* class_name : { "x", "y", "z" })
+	{
+		ElementList expected, elements;
+		ReferenceSearch(expected, root_element, [&](Element* element) { return element->IsClassSet(class_name); }, false);
+		ElementUtilities::GetElementsByClassName(elements, root_element, class_name);
+		result &= (elements == expected);
+	}
+
+	return result;
+}
+
+TEST_CASE("element.lookup_index")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_lookup_rml);
+	REQUIRE(document);
+
+	Element* a = document->GetElementById("a");
+	Element* c = document->GetElementById("c");
+	REQUIRE(a);
+	REQUIRE(c);
+
+	CHECK(LookupsMatchReference(document));
+	CHECK(LookupsMatchReference(a));
+	CHECK(LookupsMatchReference(c));
+
+	// The shallowest element wins for duplicate ids.
+	CHECK(document->GetElementById("b")->GetTagName() == "p");
+	CHECK(ElementUtilities::GetElementById(c, "b")->GetTagName() == "span");
+
+	SUBCASE("Attributes")
+	{
+		c->SetId("e");
+		a->SetClass("x", false);
+		a->SetClass("z", true);
+		c->SetClassNames("z y");
+		document->GetElementById("d")->SetAttribute("class", "x x");
+		document->GetElementById("d")->SetClass("x", false);
+
+		CHECK(document->GetElementById("c") == nullptr);
+		CHECK(document->GetElementById("e") == c);
+		CHECK(LookupsMatchReference(document));
+		CHECK(LookupsMatchReference(c));
+	}
+
+	SUBCASE("Mutation")
+	{
+		// Move an element into a new subtree, remove another subtree, and add new elements.
+		Element* d = document->GetElementById("d");
+		c->AppendChild(d->GetParentNode()->RemoveChild(d));
+		CHECK(LookupsMatchReference(document));
+		CHECK(LookupsMatchReference(c));
+
+		ElementPtr removed = document->RemoveChild(a);
+		CHECK(LookupsMatchReference(document));
+		CHECK(document->GetElementById("d") == nullptr);
+
+		document->SetInnerRML("<div id='e' class='z'><span id='a'/></div>");
+		CHECK(LookupsMatchReference(document));
+		CHECK(document->GetElementById("a")->GetTagName() == "span");
+
+		// Lookups on detached elements search their subtree directly.
+		CHECK(LookupsMatchReference(removed.get()));
+		CHECK(removed->GetElementById("d") == d);
+	}
+
+	document->Close();
+	context->Update();
+
+	TestsShell::ShutdownShell();
+}
@@ -0,0 +1,173 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsInterface.h"
+#include "../Common/TestsShell.h"
+#include "../../../Source/Core/GeometryArena.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Core.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/Geometry.h>
+#include <RmlUi/Core/GeometryUtilities.h>
+#include <doctest.h>
+
+using namespace Rml;
+
+static bool QuadMatches(GeometryArena& arena, GeometryArena::Handle handle, int i)
+{
+	if (arena.GetNumVertices(handle) != 4 || arena.GetNumIndices(handle) != 6)
+		return false;
+
+	Vertex* vertices = arena.GetVertices(handle);
+	for (int j = 0; j < 4; j++)
+	{
+		if (vertices[j].colour != Colourb(byte(i), byte(i >> 8), 0))
+			return false;
+	}
+
+	return true;
+}
+
+TEST_CASE("geometry_arena.compaction")
+{
+	const int num_quads = 2000;
+
+	Vector<Geometry> owners(num_quads);
+	Vector<GeometryArena::Handle> handles(num_quads);
+
+	GeometryArena arena;
+
+	for (int i = 0; i < num_quads; i++)
+	{
+		Vector<Vertex> vertices(4);
+		Vector<int> indices(6);
+		GeometryUtilities::GenerateQuad(vertices.data(), indices.data(), Vector2f(0), Vector2f(1), Colourb(byte(i), byte(i >> 8), 0));
+
+		handles[i] = arena.Insert(&owners[i], vertices, indices);
+
+		// The memory of the geometry's own buffers should be released.
+		CHECK(vertices.capacity() == 0);
+		CHECK(indices.capacity() == 0);
+	}
+
+	CHECK(arena.GetVertexBufferSize() == 4 * num_quads);
+	CHECK(arena.GetIndexBufferSize() == 6 * num_quads);
+
+	// Erase most of the quads, which should compact the buffers at some point.
+	for (int i = 0; i < num_quads; i++)
+	{
+		if (i % 4 != 0)
+			arena.Erase(handles[i]);
+	}
+
+	CHECK(arena.GetVertexBufferSize() < 4 * num_quads);
+
+	bool all_match = true;
+	for (int i = 0; i < num_quads; i += 4)
+		all_match &= QuadMatches(arena, handles[i], i);
+	CHECK(all_match);
+
+	// Extracting returns the data to the geometry.
+	Vector<Vertex> vertices;
+	Vector<int> indices;
+	arena.Extract(handles[0], vertices, indices);
+	CHECK(vertices.size() == 4);
+	CHECK(indices.size() == 6);
+
+	// Inserting after erasing reuses the handles.
+	const GeometryArena::Handle handle = arena.Insert(&owners[0], vertices, indices);
+	CHECK(handle == handles[0]);
+	CHECK(QuadMatches(arena, handle, 0));
+}
+
+static const String document_arena_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<style>
+		body { display: block; width: 100px; height: 100px; }
+		div { display: block; height: 10px; background-color: #f00; border: 1px #0f0; }
+	</style>
+</head>
+
+<body>
+<div/><div/><div/><div/><div/>
+</body>
+</rml>
+)";
+
+TEST_CASE("geometry_arena.context")
+{
+	TestsRenderInterface::Options options;
+	options.record_geometry = true;
+	TestsRenderInterface render_interface(options);
+	Context* context = TestsShell::CreateContext("arena", Vector2i(100, 100), &render_interface);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_arena_rml);
+	REQUIRE(document);
+	document->Show();
+
+	context->Update();
+	context->Render();
+
+	const Vector2f sum_expected = render_interface.GetRenderedPositionSum();
+	const int num_vertices_expected = render_interface.GetNumRenderedVertices();
+	REQUIRE(num_vertices_expected > 0);
+
+	// Rendering from the arena, both when the geometry is first moved into it and afterwards, should give the same result.
+	context->EnableGeometryArena(true);
+	for (int i = 0; i < 2; i++)
+	{
+		render_interface.ResetRecording();
+		context->Render();
+		CHECK(render_interface.GetRenderedPositionSum() == sum_expected);
+		CHECK(render_interface.GetNumRenderedVertices() == num_vertices_expected);
+	}
+
+	// Regenerating geometry while in the arena.
+	document->SetProperty(PropertyId::BackgroundColor, Property(Colourb(0, 0, 255), Property::COLOUR));
+	for (Element* child = document->GetFirstChild(); child; child = child->GetNextSibling())
+		child->SetProperty(PropertyId::BorderTopWidth, Property(2.f, Property::PX));
+	render_interface.ResetRecording();
+	context->Update();
+	context->Render();
+
+	const Vector2f sum_regenerated = render_interface.GetRenderedPositionSum();
+
+	// Disabling the arena moves all geometry back, and should render the same.
+	context->EnableGeometryArena(false);
+	render_interface.ResetRecording();
+	context->Render();
+	CHECK(render_interface.GetRenderedPositionSum() == sum_regenerated);
+
+	document->Close();
+	context->Update();
+	TestsShell::RemoveContext(context);
+
+	TestsShell::ShutdownShell();
+}
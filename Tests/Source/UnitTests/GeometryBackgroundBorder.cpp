@@ -0,0 +1,89 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../../../Source/Core/GeometryBackgroundBorder.h"
+#include <RmlUi/Core/Box.h>
+#include <RmlUi/Core/Types.h>
+#include <doctest.h>
+
+using namespace Rml;
+
+TEST_CASE("geometry_background_border.rounded_corners")
+{
+	// A 100x60 box with a uniform 20px border radius, the background is drawn as a fan through the four corner arcs.
+	const float radius = 20.f;
+	const Box box(Vector2f(100.f, 60.f));
+
+	Vector<Vertex> vertices;
+	Vector<int> indices;
+	GeometryBackgroundBorder::Draw(vertices, indices, CornerSizes{ radius, radius, radius, radius }, box, Vector2f(10.f, 10.f), Colourb(255), nullptr);
+
+	REQUIRE(vertices.size() % 4 == 0);
+	const int num_points = (int)vertices.size() / 4;
+	REQUIRE(num_points >= 2);
+
+	const Vector2f centers[4] = {
+		Vector2f(30.f, 30.f),
+		Vector2f(90.f, 30.f),
+		Vector2f(90.f, 50.f),
+		Vector2f(30.f, 50.f),
+	};
+
+	// Each corner should start and end exactly on the box edges, in clockwise order, with all points on the circle.
+	const Vector2f expected_ends[4][2] = {
+		{ Vector2f(10.f, 30.f), Vector2f(30.f, 10.f) },
+		{ Vector2f(90.f, 10.f), Vector2f(110.f, 30.f) },
+		{ Vector2f(110.f, 50.f), Vector2f(90.f, 70.f) },
+		{ Vector2f(30.f, 70.f), Vector2f(10.f, 50.f) },
+	};
+
+	for (int corner = 0; corner < 4; corner++)
+	{
+		const Vertex* arc = vertices.data() + corner * num_points;
+
+		CHECK(arc[0].position.x == doctest::Approx(expected_ends[corner][0].x));
+		CHECK(arc[0].position.y == doctest::Approx(expected_ends[corner][0].y));
+		CHECK(arc[num_points - 1].position.x == doctest::Approx(expected_ends[corner][1].x));
+		CHECK(arc[num_points - 1].position.y == doctest::Approx(expected_ends[corner][1].y));
+
+		for (int i = 0; i < num_points; i++)
+			CHECK((arc[i].position - centers[corner]).Magnitude() == doctest::Approx(radius));
+	}
+
+	// Drawing the same shape elsewhere only translates the vertices.
+	Vector<Vertex> translated_vertices;
+	indices.clear();
+	GeometryBackgroundBorder::Draw(translated_vertices, indices, CornerSizes{ radius, radius, radius, radius }, box, Vector2f(60.f, 110.f), Colourb(255), nullptr);
+
+	REQUIRE(translated_vertices.size() == vertices.size());
+	for (size_t i = 0; i < vertices.size(); i++)
+	{
+		CHECK(translated_vertices[i].position.x == doctest::Approx(vertices[i].position.x + 50.f));
+		CHECK(translated_vertices[i].position.y == doctest::Approx(vertices[i].position.y + 100.f));
+	}
+}
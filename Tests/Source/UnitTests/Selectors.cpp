@@ -104,6 +104,10 @@ static const Vector<QuerySelector> query_selectors =
 	{ "span:empty",                  "Y D0 D1 F0" },
 	{ ".hello.world, #P span, #I",   "Z D0 D1 F0 I" },
 	{ "body * span",                 "D0 D1 F0" },
+	{ "#P .hello",                   "H" },
+	{ ".world, #D0",                 "Y Z D0" },
+	{ "#D > #D1",                    "D1" },
+	{ "#Q, .nothing",                "" },
 };
 struct ClosestSelector {
 	String start_id;
@@ -219,6 +223,38 @@ TEST_CASE("Selectors")
 		context->UnloadDocument(document);
 	}
 
+	SUBCASE("QuerySelector(All) after changes")
+	{
+		const String document_string = doc_begin + doc_end;
+		ElementDocument* document = context->LoadDocumentFromMemory(document_string);
+		REQUIRE(document);
+
+		// The same selectors are reused from the cache, they must still see changes to the document.
+		ElementList elements;
+		document->QuerySelectorAll(elements, ".hello");
+		CHECK(ElementListToIds(elements) == "X Z H");
+
+		document->GetElementById("D0")->SetClass("hello", true);
+		document->GetElementById("Z")->SetClass("hello", false);
+
+		elements.clear();
+		document->QuerySelectorAll(elements, ".hello");
+		CHECK(ElementListToIds(elements) == "X D0 H");
+
+		// Only the descendants of the element are searched.
+		Element* parent = document->GetElementById("P");
+		elements.clear();
+		parent->QuerySelectorAll(elements, ".hello");
+		CHECK(ElementListToIds(elements) == "D0 H");
+		CHECK(parent->QuerySelector(".hello") == document->GetElementById("D0"));
+
+		document->GetElementById("D")->SetId("Q");
+		CHECK(document->QuerySelector("#D") == nullptr);
+		CHECK(document->QuerySelector("#Q > span") == document->GetElementById("D0"));
+
+		context->UnloadDocument(document);
+	}
+
 	SUBCASE("Closest")
 	{
 		const String document_string = doc_begin + doc_end;
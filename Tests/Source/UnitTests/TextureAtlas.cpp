@@ -0,0 +1,178 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsInterface.h"
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Core.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <doctest.h>
+#include <float.h>
+
+using namespace Rml;
+
+static const String document_atlas_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<style>
+		body { display: block; width: 500px; height: 500px; }
+	</style>
+</head>
+
+<body>
+<img src="icon_a.png"/><img src="icon_b.png"/><img src="icon_c.png"/><img src="icon_a.png"/>
+<img src="large.png"/>
+<div style="display: none;"><img src="unused.png"/></div>
+</body>
+</rml>
+)";
+
+// Returns the range of the texture coordinates of the recorded geometry.
+static void GetRenderedTexCoordRange(const TestsRenderInterface& render_interface, Vector2f& min_texcoord, Vector2f& max_texcoord)
+{
+	min_texcoord = Vector2f(FLT_MAX);
+	max_texcoord = Vector2f(-FLT_MAX);
+	for (const TestsRenderInterface::RenderedGeometry& geometry : render_interface.GetRecording().geometry)
+	{
+		for (const Vertex& vertex : geometry.vertices)
+		{
+			for (int j = 0; j < 2; j++)
+			{
+				min_texcoord[j] = Math::Min(min_texcoord[j], vertex.tex_coord[j]);
+				max_texcoord[j] = Math::Max(max_texcoord[j], vertex.tex_coord[j]);
+			}
+		}
+	}
+}
+
+static void RenderDocument(Context* context, bool expect_atlas)
+{
+	ElementDocument* document = context->LoadDocumentFromMemory(document_atlas_rml);
+	REQUIRE(document);
+	document->Show();
+
+	context->Update();
+	context->Render();
+
+	// The images keep their own dimensions.
+	CHECK(document->GetChild(0)->GetBox().GetSize() == Vector2f(16));
+	CHECK(document->GetChild(4)->GetBox().GetSize() == Vector2f(expect_atlas ? 300.f : 16.f));
+
+	document->Close();
+	context->Update();
+}
+
+TEST_CASE("texture_atlas")
+{
+	bool load_data = true;
+	int num_data_loaded = 0;
+
+	// Generates the pixels of textures from their source names.
+	TestsRenderInterface::Options options;
+	options.record_geometry = true;
+	options.texture_dimensions = Vector2i(16);
+	options.load_texture_data = [&](UniquePtr<const byte[]>& data, Vector2i& dimensions, const String& source) {
+		if (!load_data)
+			return false;
+
+		num_data_loaded += 1;
+
+		dimensions = (source.find("large") != String::npos ? Vector2i(300) : Vector2i(16));
+		byte* pixels = new byte[dimensions.x * dimensions.y * 4];
+		for (int i = 0; i < dimensions.x * dimensions.y * 4; i++)
+			pixels[i] = byte(i);
+		data.reset(pixels);
+		return true;
+	};
+
+	TestsRenderInterface render_interface(options);
+	Context* context = TestsShell::CreateContext("texture_atlas", Vector2i(500, 500), &render_interface);
+	const TestsRenderInterface::Recording& recording = render_interface.GetRecording();
+
+	SUBCASE("packed")
+	{
+		Rml::SetTextureAtlas(64, 256);
+		RenderDocument(context, true);
+
+		// One atlas page for the three small images, and the large image generated on its own.
+		REQUIRE(recording.generated_texture_dimensions.size() == 2);
+		CHECK(render_interface.GetCounters().load_texture == 0);
+
+		// Only the images used during layout are loaded, the one not displayed is left alone.
+		CHECK(num_data_loaded == 4);
+		CHECK(recording.generated_texture_dimensions[0] == Vector2i(300));
+		CHECK(recording.generated_texture_dimensions[1].x <= 256);
+		CHECK(recording.generated_texture_dimensions[1].y <= 256);
+
+		CHECK(render_interface.GetRenderedTextures().size() == 2);
+
+		// The texture coordinates are rewritten to the atlas page, while the large image keeps the whole texture.
+		Vector2f min_texcoord, max_texcoord;
+		GetRenderedTexCoordRange(render_interface, min_texcoord, max_texcoord);
+		CHECK(min_texcoord == Vector2f(0.f));
+		CHECK(max_texcoord == Vector2f(1.f));
+
+		render_interface.ResetRecording();
+
+		ElementDocument* document = context->LoadDocumentFromMemory(R"(<rml><body><img src="icon_b.png"/></body></rml>)");
+		document->Show();
+		context->Update();
+		context->Render();
+
+		CHECK(render_interface.GetRenderedTextures().size() == 1);
+		GetRenderedTexCoordRange(render_interface, min_texcoord, max_texcoord);
+		CHECK(min_texcoord.x > 0.f);
+		CHECK(max_texcoord.x < 1.f);
+
+		document->Close();
+		context->Update();
+
+		// Both the page and the large texture are released.
+		Rml::ReleaseTextures();
+		CHECK(render_interface.GetCounters().release_texture == 2);
+	}
+
+	SUBCASE("unsupported")
+	{
+		load_data = false;
+		Rml::SetTextureAtlas(64, 256);
+		RenderDocument(context, false);
+
+		// Without the pixel data, each texture is loaded on its own.
+		CHECK(recording.generated_texture_dimensions.empty());
+		CHECK(render_interface.GetCounters().load_texture == 4);
+		CHECK(render_interface.GetRenderedTextures().size() == 4);
+	}
+
+	Rml::SetTextureAtlas(0);
+	Rml::ReleaseTextures();
+	TestsShell::RemoveContext(context);
+
+	TestsShell::ShutdownShell();
+}
@@ -0,0 +1,228 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsInterface.h"
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Core.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/ElementInstancer.h>
+#include <RmlUi/Core/Factory.h>
+#include <doctest.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace Rml;
+
+static const String document_loader_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<style>
+		body { display: block; width: 500px; height: 500px; }
+	</style>
+</head>
+
+<body>
+<img src="/assets/high_scores_alien_1.tga"/><img src="/assets/high_scores_alien_2.tga"/><img src="/assets/high_scores_alien_3.tga"/>
+<img src="/assets/does_not_exist.tga"/>
+</body>
+</rml>
+)";
+
+// Records the textures generated and rendered, textures should never be loaded through the render interface directly.
+static TestsRenderInterface::Options GetLoaderOptions()
+{
+	TestsRenderInterface::Options options;
+	options.record_geometry = true;
+	options.texture_dimensions = Vector2i(0);
+	return options;
+}
+
+TEST_CASE("texture_loader")
+{
+	TestsRenderInterface render_interface(GetLoaderOptions());
+	Context* context = TestsShell::CreateContext("texture_loader", Vector2i(500, 500), &render_interface);
+
+	std::atomic<int> num_decoded(0);
+	int num_succeeded = 0;
+	int num_failed = 0;
+
+	// Ignore the file contents, but size each texture by its file size so that we know it was read.
+	auto decoder = [&](const String& /*source*/, const byte* /*file_data*/, size_t file_size, UniquePtr<const byte[]>& data, Vector2i& dimensions) {
+		num_decoded += 1;
+		dimensions = Vector2i(int(file_size % 64) + 1, 8);
+		data.reset(new byte[dimensions.x * dimensions.y * 4]());
+		return true;
+	};
+	auto loaded_callback = [&](const String& /*source*/, bool success) {
+		if (success)
+			num_succeeded += 1;
+		else
+			num_failed += 1;
+	};
+
+	const int max_uploads_per_frame = 2;
+	Rml::SetAsyncTextureLoading(decoder, max_uploads_per_frame, loaded_callback);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_loader_rml);
+	REQUIRE(document);
+	document->Show();
+
+	// The images are laid out without any size until their textures have been uploaded.
+	context->Update();
+	CHECK(document->GetChild(0)->GetBox().GetSize() == Vector2f(0.f));
+
+	// The missing file is reported once.
+	TestsShell::SetNumExpectedWarnings(1);
+
+	for (int i = 0; i < 1000 && num_succeeded + num_failed < 4; i++)
+	{
+		const int num_finished = num_succeeded + num_failed;
+		context->Render();
+		CHECK(num_succeeded + num_failed - num_finished <= max_uploads_per_frame);
+
+		context->Update();
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+
+	CHECK(num_decoded == 3);
+	CHECK(num_succeeded == 3);
+	CHECK(num_failed == 1);
+	CHECK(render_interface.GetCounters().load_texture == 0);
+	CHECK(render_interface.GetCounters().generate_texture == 3);
+
+	// The images are laid out again with the loaded dimensions, and rendered with their textures.
+	for (int i = 0; i < 3; i++)
+	{
+		const Vector2f size = document->GetChild(i)->GetBox().GetSize();
+		CHECK(size.x > 0.f);
+		CHECK(size.y == 8.f);
+	}
+
+	render_interface.ResetRecording();
+	context->Render();
+	CHECK(render_interface.GetRenderedTextures().size() == 3);
+
+	TestsShell::SetNumExpectedWarnings(0);
+
+	document->Close();
+	context->Update();
+
+	Rml::SetAsyncTextureLoading(nullptr);
+	Rml::ReleaseTextures();
+	TestsShell::RemoveContext(context);
+
+	TestsShell::ShutdownShell();
+}
+
+static const String document_notify_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<style>
+		body { display: block; width: 500px; height: 500px; }
+		texture-observer { display: block; width: 50px; height: 50px; }
+		#decorated { decorator: image(/assets/high_scores_alien_1.tga); }
+	</style>
+</head>
+
+<body>
+<texture-observer id="decorated"/>
+<texture-observer id="plain"/>
+</body>
+</rml>
+)";
+
+// Counts the notifications about loaded textures.
+class ElementTextureObserver : public Element {
+public:
+	ElementTextureObserver(const String& tag) : Element(tag) {}
+
+	int num_textures_loaded = 0;
+
+protected:
+	void OnTexturesLoaded() override
+	{
+		Element::OnTexturesLoaded();
+		num_textures_loaded += 1;
+	}
+};
+
+TEST_CASE("texture_loader.notify_waiting_elements")
+{
+	ElementInstancerGeneric<ElementTextureObserver> instancer;
+	Factory::RegisterElementInstancer("texture-observer", &instancer);
+
+	TestsRenderInterface render_interface(GetLoaderOptions());
+	Context* context = TestsShell::CreateContext("texture_loader", Vector2i(500, 500), &render_interface);
+
+	int num_loaded = 0;
+	auto decoder = [](const String& /*source*/, const byte* /*file_data*/, size_t /*file_size*/, UniquePtr<const byte[]>& data, Vector2i& dimensions) {
+		dimensions = Vector2i(8, 8);
+		data.reset(new byte[dimensions.x * dimensions.y * 4]());
+		return true;
+	};
+	Rml::SetAsyncTextureLoading(decoder, 1, [&](const String& /*source*/, bool /*success*/) { num_loaded += 1; });
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_notify_rml);
+	REQUIRE(document);
+	document->Show();
+
+	auto decorated = static_cast<ElementTextureObserver*>(document->GetElementById("decorated"));
+	auto plain = static_cast<ElementTextureObserver*>(document->GetElementById("plain"));
+	REQUIRE(decorated);
+	REQUIRE(plain);
+
+	for (int i = 0; i < 1000 && num_loaded < 1; i++)
+	{
+		context->Update();
+		context->Render();
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	REQUIRE(num_loaded == 1);
+
+	// Only the element using the texture is notified, and then renders it.
+	CHECK(decorated->num_textures_loaded == 1);
+	CHECK(plain->num_textures_loaded == 0);
+
+	render_interface.ResetRecording();
+	context->Update();
+	context->Render();
+	CHECK(render_interface.GetRenderedTextures().size() == 1);
+
+	document->Close();
+	context->Update();
+
+	Rml::SetAsyncTextureLoading(nullptr);
+	Rml::ReleaseTextures();
+	TestsShell::RemoveContext(context);
+
+	TestsShell::ShutdownShell();
+}
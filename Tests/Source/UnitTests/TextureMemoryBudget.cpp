@@ -0,0 +1,208 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsInterface.h"
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Core.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <doctest.h>
+
+using namespace Rml;
+
+static const String document_images_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<style>
+		body { display: block; width: 500px; height: 500px; }
+	</style>
+</head>
+
+<body>
+<img src="image_a.png"/><img src="image_b.png"/><img src="image_c.png"/><img src="image_d.png"/>
+</body>
+</rml>
+)";
+
+static const String document_text_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<style>
+		body { display: block; width: 500px; height: 500px; font-family: LatoLatin; font-size: 20px; }
+	</style>
+</head>
+
+<body>Hello world</body>
+</rml>
+)";
+
+TEST_CASE("texture_memory_budget")
+{
+	// Loads every texture from file as 16x16 pixels, and records the textures rendered.
+	TestsRenderInterface::Options options;
+	options.record_geometry = true;
+	options.texture_dimensions = Vector2i(16);
+	TestsRenderInterface render_interface(options);
+	Context* context = TestsShell::CreateContext("texture_memory_budget", Vector2i(500, 500), &render_interface);
+
+	constexpr size_t image_size = 16 * 16 * 4;
+
+	SUBCASE("images")
+	{
+		ElementDocument* document = context->LoadDocumentFromMemory(document_images_rml);
+		REQUIRE(document);
+		document->Show();
+		context->Update();
+		context->Render();
+
+		TextureStatistics statistics = Rml::GetTextureStatistics();
+		CHECK(statistics.memory_budget == 0);
+		CHECK(statistics.memory_used == 4 * image_size);
+		CHECK(statistics.num_textures == 4);
+
+		// Textures still referenced by the document are kept even when over budget.
+		Rml::SetTextureMemoryBudget(2 * image_size);
+		context->Render();
+
+		statistics = Rml::GetTextureStatistics();
+		CHECK(statistics.memory_budget == 2 * image_size);
+		CHECK(statistics.memory_used == 4 * image_size);
+		CHECK(statistics.num_evicted == 0);
+		CHECK(render_interface.GetCounters().release_texture == 0);
+
+		// Once unreferenced, textures are evicted until within budget.
+		document->Close();
+		context->Update();
+		context->Render();
+
+		statistics = Rml::GetTextureStatistics();
+		CHECK(statistics.memory_used == 2 * image_size);
+		CHECK(statistics.num_textures == 2);
+		CHECK(statistics.num_evicted == 2);
+		CHECK(render_interface.GetCounters().release_texture == 2);
+	}
+
+	SUBCASE("font_textures")
+	{
+		Rml::SetTextureMemoryBudget(1);
+
+		ElementDocument* document = context->LoadDocumentFromMemory(document_text_rml);
+		REQUIRE(document);
+		document->Show();
+		context->Update();
+		context->Render();
+
+		// Font textures used in the frame are kept.
+		REQUIRE(render_interface.GetCounters().generate_texture > 0);
+		CHECK(render_interface.GetCounters().release_texture == 0);
+		const SmallUnorderedSet<TextureHandle> rendered_textures = render_interface.GetRenderedTextures();
+		CHECK(rendered_textures.size() == 1);
+
+		// They are evicted when not rendered in a frame, and generated again with a new handle when needed. Eviction
+		// happens once the context is rendered again in the next frame.
+		document->Hide();
+		context->Update();
+		context->Render();
+		CHECK(render_interface.GetCounters().release_texture == 0);
+		context->Render();
+
+		CHECK(render_interface.GetCounters().release_texture == render_interface.GetCounters().generate_texture);
+		CHECK(Rml::GetTextureStatistics().memory_used == 0);
+
+		const size_t num_generated = render_interface.GetCounters().generate_texture;
+		render_interface.ResetRecording();
+
+		document->Show();
+		context->Update();
+		context->Render();
+
+		CHECK(render_interface.GetCounters().generate_texture == 2 * num_generated);
+		REQUIRE(render_interface.GetRenderedTextures().size() == 1);
+		CHECK(*render_interface.GetRenderedTextures().begin() != *rendered_textures.begin());
+
+		document->Close();
+		context->Update();
+	}
+
+	SUBCASE("multiple_contexts")
+	{
+		Context* other_context = TestsShell::CreateContext("texture_memory_budget_other", Vector2i(500, 500), &render_interface);
+
+		ElementDocument* document = context->LoadDocumentFromMemory(document_text_rml);
+		ElementDocument* other_document = other_context->LoadDocumentFromMemory(document_text_rml);
+		REQUIRE(document);
+		REQUIRE(other_document);
+		other_document->SetProperty(PropertyId::FontSize, Property(30.f, Property::PX));
+		document->Show();
+		other_document->Show();
+
+		auto render_frame = [&]() {
+			context->Update();
+			other_context->Update();
+			context->Render();
+			other_context->Render();
+		};
+
+		render_frame();
+		const TextureStatistics statistics = Rml::GetTextureStatistics();
+		REQUIRE(statistics.memory_used > 0);
+		Rml::SetTextureMemoryBudget(statistics.memory_used - 1);
+
+		// Textures used by either context in the frame are kept, even if the other context was rendered last.
+		const size_t num_generated = render_interface.GetCounters().generate_texture;
+		for (int i = 0; i < 3; i++)
+			render_frame();
+
+		CHECK(Rml::GetTextureStatistics().num_evicted == 0);
+		CHECK(render_interface.GetCounters().generate_texture == num_generated);
+		CHECK(render_interface.GetCounters().release_texture == 0);
+
+		// Textures no longer used by any context are evicted.
+		other_document->Hide();
+		render_frame();
+		render_frame();
+
+		CHECK(Rml::GetTextureStatistics().num_evicted > 0);
+		CHECK(render_interface.GetCounters().generate_texture == num_generated);
+		CHECK(render_interface.GetCounters().release_texture > 0);
+
+		document->Close();
+		other_document->Close();
+		context->Update();
+		other_context->Update();
+		TestsShell::RemoveContext(other_context);
+	}
+
+	Rml::SetTextureMemoryBudget(0);
+	Rml::ReleaseTextures();
+	TestsShell::RemoveContext(context);
+
+	TestsShell::ShutdownShell();
+}
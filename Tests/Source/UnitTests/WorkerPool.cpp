@@ -0,0 +1,146 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsInterface.h"
+#include "../Common/TestsShell.h"
+#include "../../../Source/Core/WorkerPool.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Core.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <doctest.h>
+
+using namespace Rml;
+
+TEST_CASE("worker_pool.parallel_for")
+{
+	WorkerPool pool(3);
+	CHECK(pool.GetNumWorkers() == 3);
+
+	const int num_tasks = 1000;
+	Vector<int> counts(num_tasks, 0);
+
+	// Run many batches in a row, to make sure workers waking up late never pick up tasks of the wrong batch.
+	const int num_batches = 200;
+	for (int batch = 0; batch < num_batches; batch++)
+	{
+		pool.ParallelFor(num_tasks, [&](int i) {
+			counts[i] += 1;
+		});
+	}
+
+	bool all_counted = true;
+	for (int count : counts)
+		all_counted &= (count == num_batches);
+	CHECK(all_counted);
+
+	int num_calls = 0;
+	pool.ParallelFor(0, [&](int) { num_calls += 1; });
+	CHECK(num_calls == 0);
+}
+
+static const String document_prepare_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<style>
+		body { display: block; width: 500px; height: 500px; }
+		div { display: inline-block; width: 20px; height: 20px; margin: 2px; border: 2px #0f0; border-radius: 5px; background-color: #f00; }
+		p { display: none; }
+	</style>
+</head>
+
+<body>
+<div/><div/><div/><div/><div/><div/><div/><div/><div/><div/>
+<div/><div/><div/><div/><div/><div/><div/><div/><div/><div/>
+<div><div/><div/></div>
+<p><div/></p>
+</body>
+</rml>
+)";
+
+TEST_CASE("worker_pool.prepare_geometry")
+{
+	TestsRenderInterface::Options options;
+	options.record_geometry = true;
+	TestsRenderInterface render_interface(options);
+	Context* context = TestsShell::CreateContext("prepare_geometry", Vector2i(500, 500), &render_interface);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_prepare_rml);
+	REQUIRE(document);
+	document->Show();
+
+	context->Update();
+	context->Render();
+
+	const Vector2f sum_expected = render_interface.GetRenderedPositionSum();
+	const int num_vertices_expected = render_interface.GetNumRenderedVertices();
+	REQUIRE(num_vertices_expected > 0);
+
+	// Regenerate all the geometry, once while drawing and once in the prepare phase, which should render the same.
+	auto ChangeBorders = [&](float width) {
+		for (int i = 0; i < document->GetNumChildren(); i++)
+			document->GetChild(i)->SetProperty(PropertyId::BorderLeftWidth, Property(width, Property::PX));
+		context->Update();
+	};
+
+	ChangeBorders(4.f);
+	render_interface.ResetRecording();
+	context->Render();
+	const Vector2f sum_changed = render_interface.GetRenderedPositionSum();
+
+	context->SetNumGeometryWorkers(3);
+
+	ChangeBorders(2.f);
+	render_interface.ResetRecording();
+	context->Render();
+	CHECK(render_interface.GetRenderedPositionSum() == sum_expected);
+	CHECK(render_interface.GetNumRenderedVertices() == num_vertices_expected);
+
+	ChangeBorders(4.f);
+	render_interface.ResetRecording();
+	context->Render();
+	CHECK(render_interface.GetRenderedPositionSum() == sum_changed);
+
+	// Only the elements dirtied since the last render are prepared, and nothing when no element is dirty.
+	context->Update();
+	context->Render();
+	CHECK(context->GetFrameStatistics().num_geometry_generated == 0);
+
+	document->GetChild(0)->SetProperty(PropertyId::BackgroundColor, Property(Colourb(0, 0, 255), Property::COLOUR));
+	context->Update();
+	context->Render();
+	CHECK(context->GetFrameStatistics().num_geometry_generated == 1);
+
+	context->SetNumGeometryWorkers(0);
+
+	document->Close();
+	context->Update();
+	TestsShell::RemoveContext(context);
+
+	TestsShell::ShutdownShell();
+}
@@ -0,0 +1,100 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include <RmlUi/Core.h>
+#include <stdio.h>
+
+/*
+	Compiles RML documents into binary documents, which are loaded by RmlUi without parsing their markup.
+
+	Usage: rmlui_compile_document <input.rml> <output> [<input.rml> <output> ...]
+
+	Paths are opened relative to the working directory. Applications registering their own structural data views
+	should compile their documents with Rml::CompileDocument() instead, so that the same views are recognized.
+*/
+
+class CompilerSystemInterface : public Rml::SystemInterface
+{
+public:
+	double GetElapsedTime() override
+	{
+		return 0.0;
+	}
+
+	bool LogMessage(Rml::Log::Type type, const Rml::String& message) override
+	{
+		if (type <= Rml::Log::LT_WARNING)
+			fprintf(stderr, "%s\n", message.c_str());
+		return true;
+	}
+};
+
+int main(int argc, char** argv)
+{
+	if (argc < 3 || argc % 2 != 1)
+	{
+		fprintf(stderr, "Usage: %s <input.rml> <output> [<input.rml> <output> ...]\n", argv[0]);
+		return 1;
+	}
+
+	CompilerSystemInterface system_interface;
+	Rml::SetSystemInterface(&system_interface);
+
+	if (!Rml::Initialise())
+		return 1;
+
+	int num_failed = 0;
+
+	for (int i = 1; i + 1 < argc; i += 2)
+	{
+		const char* input_path = argv[i];
+		const char* output_path = argv[i + 1];
+
+		Rml::String compiled_document;
+		if (!Rml::CompileDocument(input_path, compiled_document))
+		{
+			fprintf(stderr, "Could not open document '%s'.\n", input_path);
+			num_failed += 1;
+			continue;
+		}
+
+		FILE* file = fopen(output_path, "wb");
+		if (!file || fwrite(compiled_document.data(), 1, compiled_document.size(), file) != compiled_document.size())
+		{
+			fprintf(stderr, "Could not write compiled document '%s'.\n", output_path);
+			num_failed += 1;
+		}
+
+		if (file)
+			fclose(file);
+	}
+
+	Rml::Shutdown();
+
+	return num_failed > 0 ? 1 : 0;
+}